@@ -0,0 +1,42 @@
+#include "rpc_bench.h"
+
+namespace {
+
+const size_t kLive = 1000;
+
+// Чередование вставок и удалений при kLive живых узлах: замеряет стоимость
+// выделения и освобождения узлов, а не обхода больших структур
+template <typename Allocator>
+void BenchChurn(const rpc_bench::Case &c, const char *impl) {
+  const size_t n = c.n;
+  auto none = [] { return rpc_bench::NoState(); };
+  rpc_bench::Run(c, "list_churn", impl, none, [n](rpc_bench::NoState &) {
+    rpc::list<int, Allocator> list;
+    for (size_t i = 0; i < n; ++i) {
+      list.push_back(static_cast<int>(i));
+      if (list.size() > kLive) list.pop_front();
+    }
+  });
+  rpc_bench::Run(c, "set_churn", impl, none, [n](rpc_bench::NoState &) {
+    rpc::set<int, Allocator> set;
+    for (size_t i = 0; i < n; ++i) {
+      set.insert(static_cast<int>(i));
+      if (i >= kLive) set.erase(set.find(static_cast<int>(i - kLive)));
+    }
+  });
+  rpc_bench::Run(c, "map_churn", impl, none, [n](rpc_bench::NoState &) {
+    rpc::map<int, int, Allocator> map;
+    for (size_t i = 0; i < n; ++i) {
+      map[static_cast<int>(i)] = static_cast<int>(i);
+      if (i >= kLive) map.erase(map.find(static_cast<int>(i - kLive)));
+    }
+  });
+}
+
+}  // namespace
+
+void rpc_bench::BenchAllocator(const Case &c) {
+  if (!IsFirstDistribution(c)) return;
+  BenchChurn<std::allocator<int>>(c, "std::allocator");
+  BenchChurn<rpc::pool_allocator<int>>(c, "rpc::pool_allocator");
+}
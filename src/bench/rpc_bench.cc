@@ -0,0 +1,254 @@
+#include "rpc_bench.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// потоки замеров выделяют память одновременно
+std::atomic<size_t> allocation_count{0};
+rpc_bench::Options options;
+std::vector<rpc_bench::Result> results;
+volatile long long sink;
+
+struct Suite {
+  const char *name;
+  void (*run)(const rpc_bench::Case &);
+};
+
+const Suite kSuites[] = {
+    {"vector", rpc_bench::BenchVector},
+    {"small_vector", rpc_bench::BenchSmallVector},
+    {"list", rpc_bench::BenchList},
+    {"intrusive_list", rpc_bench::BenchIntrusiveList},
+    {"unrolled_list", rpc_bench::BenchUnrolledList},
+    {"queue", rpc_bench::BenchQueue},
+    {"stack", rpc_bench::BenchStack},
+    {"set", rpc_bench::BenchSet},
+    {"map", rpc_bench::BenchMap},
+    {"unordered_map", rpc_bench::BenchUnorderedMap},
+    {"unordered_set", rpc_bench::BenchUnorderedSet},
+    {"spsc_queue", rpc_bench::BenchSpscQueue},
+    {"mpmc_queue", rpc_bench::BenchMpmcQueue},
+    {"concurrent_stack", rpc_bench::BenchConcurrentStack},
+    {"allocator", rpc_bench::BenchAllocator},
+};
+
+std::vector<std::string> Split(const char *value) {
+  std::vector<std::string> parts;
+  std::string part;
+  for (const char *c = value; *c; ++c) {
+    if (*c == ',') {
+      parts.push_back(part);
+      part.clear();
+    } else {
+      part += *c;
+    }
+  }
+  parts.push_back(part);
+  return parts;
+}
+
+bool ParseArgs(int argc, char *argv[]) {
+  bool ok = true;
+  for (int i = 1; i < argc && ok; ++i) {
+    const char *arg = argv[i];
+    const char *value = std::strchr(arg, '=');
+    value = value ? value + 1 : "";
+    if (!std::strncmp(arg, "--sizes=", 8)) {
+      options.sizes.clear();
+      for (const std::string &size : Split(value)) {
+        options.sizes.push_back(std::strtoull(size.c_str(), nullptr, 10));
+      }
+    } else if (!std::strncmp(arg, "--dist=", 7)) {
+      options.distributions.clear();
+      for (const std::string &name : Split(value)) {
+        if (name == "sorted") {
+          options.distributions.push_back(rpc_bench::Distribution::kSorted);
+        } else if (name == "random") {
+          options.distributions.push_back(rpc_bench::Distribution::kRandom);
+        } else if (name == "zipf") {
+          options.distributions.push_back(rpc_bench::Distribution::kZipf);
+        } else {
+          ok = false;
+        }
+      }
+    } else if (!std::strncmp(arg, "--filter=", 9)) {
+      options.filter = value;
+    } else if (!std::strncmp(arg, "--json=", 7)) {
+      options.json_path = value;
+    } else if (!std::strncmp(arg, "--seed=", 7)) {
+      options.seed = static_cast<unsigned>(std::strtoul(value, nullptr, 10));
+    } else if (!std::strncmp(arg, "--warmup=", 9)) {
+      options.warmup = std::atoi(value);
+    } else {
+      ok = false;
+    }
+  }
+  if (!ok) {
+    std::fprintf(stderr,
+                 "usage: %s [--sizes=N,...] [--dist=sorted,random,zipf] "
+                 "[--filter=SUITE] [--json=FILE] [--seed=N] [--warmup=N]\n",
+                 argv[0]);
+  }
+  return ok;
+}
+
+bool WriteJson(const std::string &path) {
+  std::FILE *file = std::fopen(path.c_str(), "w");
+  if (!file) return false;
+  std::fprintf(file, "{\n  \"seed\": %u,\n  \"results\": [", options.seed);
+  for (size_t i = 0; i < results.size(); ++i) {
+    const rpc_bench::Result &r = results[i];
+    double n = static_cast<double>(r.n ? r.n : 1);
+    std::fprintf(file,
+                 "%s\n    {\"suite\": \"%s\", \"op\": \"%s\", \"impl\": "
+                 "\"%s\", \"dist\": \"%s\", \"n\": %zu, \"seconds\": %.9f, "
+                 "\"ns_per_op\": %.3f, \"ops_per_sec\": %.0f, "
+                 "\"allocs_per_op\": %.4f}",
+                 i ? "," : "", r.suite.c_str(), r.op.c_str(), r.impl.c_str(),
+                 r.distribution.c_str(), r.n, r.seconds, r.seconds * 1e9 / n,
+                 r.seconds > 0 ? n / r.seconds : 0.0,
+                 static_cast<double>(r.allocs) / n);
+  }
+  std::fprintf(file, "\n  ]\n}\n");
+  return std::fclose(file) == 0;
+}
+
+}  // namespace
+
+// Подсчёт выделений памяти для замеров
+void *operator new(size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  void *ptr = std::malloc(size ? size : 1);
+  if (!ptr) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+const rpc_bench::Options &rpc_bench::GetOptions() { return options; }
+
+size_t rpc_bench::AllocationCount() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
+void rpc_bench::Consume(long long value) { sink = value; }
+
+const char *rpc_bench::DistributionName(Distribution distribution) {
+  const char *name = "sorted";
+  if (distribution == Distribution::kRandom) {
+    name = "random";
+  } else if (distribution == Distribution::kZipf) {
+    name = "zipf";
+  }
+  return name;
+}
+
+std::vector<int> rpc_bench::MakeKeys(Distribution distribution, size_t n,
+                                     unsigned seed) {
+  std::vector<int> keys(n);
+  for (size_t i = 0; i < n; ++i) keys[i] = static_cast<int>(i);
+  std::mt19937 gen(seed);
+  if (distribution == Distribution::kRandom) {
+    std::shuffle(keys.begin(), keys.end(), gen);
+  } else if (distribution == Distribution::kZipf && n > 0) {
+    // ранг r выпадает с вероятностью ~ 1 / (r + 1), ранги отображаются на
+    // случайную перестановку ключей, чтобы частые ключи не шли подряд
+    std::vector<double> cdf(n);
+    double sum = 0;
+    for (size_t r = 0; r < n; ++r) {
+      sum += 1.0 / static_cast<double>(r + 1);
+      cdf[r] = sum;
+    }
+    std::vector<int> ranks(keys);
+    std::shuffle(ranks.begin(), ranks.end(), gen);
+    std::uniform_real_distribution<double> uniform(0, sum);
+    for (size_t i = 0; i < n; ++i) {
+      size_t r = std::lower_bound(cdf.begin(), cdf.end(), uniform(gen)) -
+                 cdf.begin();
+      keys[i] = ranks[std::min(r, n - 1)];
+    }
+  }
+  return keys;
+}
+
+void rpc_bench::PinThread(unsigned cpu) {
+#ifdef __linux__
+  unsigned count = std::thread::hardware_concurrency();
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(count ? cpu % count : 0, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpu;
+#endif
+}
+
+void rpc_bench::RecordLatencies(const Case &c, const char *op,
+                                const char *impl,
+                                std::vector<double> &samples) {
+  if (samples.empty()) return;
+  std::sort(samples.begin(), samples.end());
+  const struct {
+    const char *suffix;
+    double rank;
+  } kPercentiles[] = {{"_p50", 0.5}, {"_p99", 0.99}, {"_p999", 0.999}};
+  for (const auto &percentile : kPercentiles) {
+    size_t index = static_cast<size_t>(percentile.rank * (samples.size() - 1));
+    Record(Result{c.suite, std::string(op) + percentile.suffix, impl,
+                  DistributionName(c.distribution), c.n,
+                  samples[index] * 1e-9 * static_cast<double>(c.n), 0});
+  }
+}
+
+void rpc_bench::Record(const Result &result) {
+  double n = static_cast<double>(result.n ? result.n : 1);
+  std::printf("%-10s %-14s %-22s %-7s n=%-9zu %10.1f ns/op %8.3f allocs/op\n",
+              result.suite.c_str(), result.op.c_str(), result.impl.c_str(),
+              result.distribution.c_str(), result.n,
+              result.seconds * 1e9 / n,
+              static_cast<double>(result.allocs) / n);
+  std::fflush(stdout);
+  results.push_back(result);
+}
+
+int main(int argc, char *argv[]) {
+  if (!ParseArgs(argc, argv)) return 1;
+  for (size_t n : options.sizes) {
+    for (rpc_bench::Distribution distribution : options.distributions) {
+      std::vector<int> keys =
+          rpc_bench::MakeKeys(distribution, n, options.seed);
+      std::vector<int> lookups(keys);
+      if (distribution != rpc_bench::Distribution::kSorted) {
+        std::shuffle(lookups.begin(), lookups.end(),
+                     std::mt19937(options.seed + 1));
+      }
+      for (const Suite &suite : kSuites) {
+        if (std::strstr(suite.name, options.filter.c_str())) {
+          suite.run(
+              rpc_bench::Case{suite.name, distribution, n, &keys, &lookups});
+        }
+      }
+    }
+  }
+  int status = 0;
+  if (!options.json_path.empty() && !WriteJson(options.json_path)) {
+    std::fprintf(stderr, "failed to write %s\n", options.json_path.c_str());
+    status = 1;
+  }
+  return status;
+}
@@ -0,0 +1,171 @@
+#ifndef RPC_BENCH_H
+#define RPC_BENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <list>
+#include <map>
+#include <mutex>
+#include <queue>
+#include <set>
+#include <stack>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../rpc_containers.h"
+
+namespace rpc_bench {
+
+/// @brief Распределение ключей во входных данных
+enum class Distribution {
+  kSorted,  ///< 0, 1, ..., n - 1 по возрастанию
+  kRandom,  ///< перестановка 0, ..., n - 1
+  kZipf     ///< n ключей из [0, n) по закону Ципфа (с повторами)
+};
+
+/// @brief Параметры запуска, задаются аргументами командной строки
+struct Options {
+  std::vector<size_t> sizes{1000, 100000, 1000000};
+  std::vector<Distribution> distributions{
+      Distribution::kSorted, Distribution::kRandom, Distribution::kZipf};
+  std::string filter;     ///< подстрока имени набора, пустая - все наборы
+  std::string json_path;  ///< файл для JSON-отчета, пустой - без отчета
+  unsigned seed = 42;
+  int warmup = 1;  ///< число прогревочных прогонов перед замером
+};
+
+/// @brief Входные данные одного замера
+struct Case {
+  const char *suite;
+  Distribution distribution;
+  size_t n;
+  const std::vector<int> *keys;
+  /// те же ключи в другом порядке, чтобы поиск не повторял порядок вставки
+  const std::vector<int> *lookups;
+};
+
+/// @brief Результат одного замера
+struct Result {
+  std::string suite;
+  std::string op;
+  std::string impl;
+  std::string distribution;
+  size_t n;
+  double seconds;
+  size_t allocs;
+};
+
+/// @brief Текущие параметры запуска
+const Options &GetOptions();
+
+/// @brief Название распределения для отчетов
+const char *DistributionName(Distribution distribution);
+
+/// @brief Генерирует n ключей с заданным распределением
+std::vector<int> MakeKeys(Distribution distribution, size_t n, unsigned seed);
+
+/// @brief Возвращает число вызовов глобального operator new с начала работы
+size_t AllocationCount();
+
+/// @brief Печатает результат и сохраняет его для JSON-отчета
+void Record(const Result &result);
+
+/// @brief Не дает компилятору выбросить вычисление значения
+void Consume(long long value);
+
+/// @brief Привязывает текущий поток к процессору cpu (по модулю числа
+/// процессоров). Вне Linux ничего не делает
+void PinThread(unsigned cpu);
+
+/// @brief Сохраняет перцентили p50, p99 и p99.9 задержек как операции
+/// op_p50, op_p99, op_p999. В этих записях ns/op - задержка одного элемента
+/// @param samples задержки в наносекундах, сортируются на месте
+void RecordLatencies(const Case &c, const char *op, const char *impl,
+                     std::vector<double> &samples);
+
+/// @brief Измеряет время выполнения функции в секундах
+/// @param func измеряемая функция
+/// @return время выполнения в секундах
+template <typename Func>
+double Measure(Func &&func) {
+  auto start = std::chrono::steady_clock::now();
+  func();
+  std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  return elapsed.count();
+}
+
+/// @brief Замер одной операции. setup() готовит состояние вне замера,
+/// body(state) измеряется. Прогревочные прогоны в замер не входят.
+/// @param c входные данные
+/// @param op название операции
+/// @param impl название реализации
+/// @param setup подготовка состояния
+/// @param body измеряемая операция
+template <typename Setup, typename Body>
+void Run(const Case &c, const char *op, const char *impl, Setup &&setup,
+         Body &&body) {
+  for (int i = 0; i < GetOptions().warmup; ++i) {
+    auto state = setup();
+    body(state);
+  }
+  auto state = setup();
+  size_t allocs = AllocationCount();
+  double seconds = Measure([&] { body(state); });
+  Record(Result{c.suite, op, impl, DistributionName(c.distribution), c.n,
+                seconds, AllocationCount() - allocs});
+}
+
+/// @brief Пустое состояние для операций, не требующих подготовки
+struct NoState {};
+
+/// @brief Текущий способ передачи данных между потоками, база для
+/// сравнения неблокирующих очередей: rpc::queue под мьютексом
+class LockedQueue {
+ public:
+  bool try_push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(long long &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  rpc::queue<long long> queue_;
+};
+
+/// @brief Замеры, не зависящие от ключей, запускаются один раз на размер -
+/// для первого из заданных распределений
+inline bool IsFirstDistribution(const Case &c) {
+  return c.distribution == GetOptions().distributions.front();
+}
+
+// Наборы замеров по контейнерам
+void BenchVector(const Case &c);
+void BenchSmallVector(const Case &c);
+void BenchList(const Case &c);
+void BenchIntrusiveList(const Case &c);
+void BenchUnrolledList(const Case &c);
+void BenchQueue(const Case &c);
+void BenchStack(const Case &c);
+void BenchSet(const Case &c);
+void BenchMap(const Case &c);
+void BenchUnorderedMap(const Case &c);
+void BenchUnorderedSet(const Case &c);
+void BenchSpscQueue(const Case &c);
+void BenchMpmcQueue(const Case &c);
+void BenchConcurrentStack(const Case &c);
+void BenchAllocator(const Case &c);
+
+}  // namespace rpc_bench
+
+#endif  // RPC_BENCH_H
@@ -0,0 +1,67 @@
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "rpc_bench.h"
+
+namespace {
+
+const size_t kThreads[] = {1, 2, 4, 8, 16, 32, 64};
+
+// Текущий способ: rpc::stack под мьютексом
+class LockedStack {
+ public:
+  void push(long long value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool try_pop(long long &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    value = stack_.top();
+    stack_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  rpc::stack<long long> stack_;
+};
+
+// threads потоков поровну делят n пар push + pop на одном стеке
+template <typename Stack>
+void Churn(Stack &stack, size_t n, size_t threads) {
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&stack, n, threads, t] {
+      rpc_bench::PinThread(static_cast<unsigned>(t));
+      long long sum = 0, value = 0;
+      for (size_t i = t; i < n; i += threads) {
+        stack.push(static_cast<long long>(i));
+        if (stack.try_pop(value)) sum += value;
+      }
+      rpc_bench::Consume(sum);
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+}
+
+template <typename Stack>
+void BenchContention(const rpc_bench::Case &c, const char *impl) {
+  for (size_t threads : kThreads) {
+    std::string op = "churn_t" + std::to_string(threads);
+    rpc_bench::Run(
+        c, op.c_str(), impl, [] { return std::make_unique<Stack>(); },
+        [&](std::unique_ptr<Stack> &stack) { Churn(*stack, c.n, threads); });
+  }
+}
+
+}  // namespace
+
+void rpc_bench::BenchConcurrentStack(const Case &c) {
+  if (!IsFirstDistribution(c)) return;
+  BenchContention<rpc::concurrent_stack<long long>>(c,
+                                                     "rpc::concurrent_stack");
+  BenchContention<LockedStack>(c, "rpc::stack+mutex");
+}
@@ -0,0 +1,98 @@
+#include "rpc_bench.h"
+
+namespace {
+
+// Объект соединения из арены: rpc::intrusive_list связывает его через hook,
+// rpc::list и std::list хранят указатель в отдельном узле
+struct Connection {
+  int id;
+  rpc::list_hook hook;
+  explicit Connection(int id) : id(id) {}
+};
+
+using Arena = std::vector<Connection>;
+using IntrusiveList = rpc::intrusive_list<Connection, &Connection::hook>;
+
+bool ById(const Connection &a, const Connection &b) { return a.id < b.id; }
+
+// Удаление по ссылке на объект. В zipf ключи повторяются и не годятся как
+// индексы арены, поэтому замер только для перестановок
+bool HasUniqueKeys(const rpc_bench::Case &c) {
+  return c.distribution != rpc_bench::Distribution::kZipf;
+}
+
+void BenchIntrusive(const rpc_bench::Case &c, Arena &arena) {
+  const char *impl = "rpc::intrusive_list";
+  auto none = [] { return rpc_bench::NoState(); };
+  auto build = [&] {
+    IntrusiveList list;
+    for (Connection &connection : arena) list.push_back(connection);
+    return list;
+  };
+  rpc_bench::Run(c, "link", impl, none, [&](rpc_bench::NoState &) {
+    rpc_bench::Consume(build().size());
+  });
+  rpc_bench::Run(c, "iterate", impl, build, [](IntrusiveList &list) {
+    long long sum = 0;
+    for (const Connection &connection : list) sum += connection.id;
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "sort", impl, build,
+                 [](IntrusiveList &list) { list.sort(ById); });
+  if (HasUniqueKeys(c)) {
+    rpc_bench::Run(c, "erase_by_ref", impl, build, [&](IntrusiveList &list) {
+      for (int key : *c.lookups) list.erase(arena[key]);
+      rpc_bench::Consume(list.size());
+    });
+  }
+}
+
+// Базовый вариант: список указателей, для удаления по ссылке рядом хранятся
+// итераторы на узлы
+template <typename List>
+void BenchPointers(const rpc_bench::Case &c, const char *impl, Arena &arena) {
+  using Iterators = std::vector<typename List::iterator>;
+  using Indexed = std::pair<List, Iterators>;
+  auto none = [] { return rpc_bench::NoState(); };
+  auto build = [&] {
+    List list;
+    for (Connection &connection : arena) list.push_back(&connection);
+    return list;
+  };
+  rpc_bench::Run(c, "link", impl, none, [&](rpc_bench::NoState &) {
+    rpc_bench::Consume(build().size());
+  });
+  rpc_bench::Run(c, "iterate", impl, build, [](List &list) {
+    long long sum = 0;
+    for (const Connection *connection : list) sum += connection->id;
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "sort", impl, build, [](List &list) {
+    list.sort([](const Connection *a, const Connection *b) {
+      return ById(*a, *b);
+    });
+  });
+  if (HasUniqueKeys(c)) {
+    auto indexed = [&] {
+      Indexed state;
+      for (Connection &connection : arena) {
+        state.first.push_back(&connection);
+        state.second.push_back(--state.first.end());
+      }
+      return state;
+    };
+    rpc_bench::Run(c, "erase_by_ref", impl, indexed, [&](Indexed &state) {
+      for (int key : *c.lookups) state.first.erase(state.second[key]);
+      rpc_bench::Consume(state.first.size());
+    });
+  }
+}
+
+}  // namespace
+
+void rpc_bench::BenchIntrusiveList(const Case &c) {
+  Arena arena(c.keys->begin(), c.keys->end());
+  BenchIntrusive(c, arena);
+  BenchPointers<rpc::list<Connection *>>(c, "rpc::list<T*>", arena);
+  BenchPointers<std::list<Connection *>>(c, "std::list<T*>", arena);
+}
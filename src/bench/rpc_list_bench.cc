@@ -0,0 +1,78 @@
+#include "rpc_bench.h"
+
+namespace {
+
+// Перенос узлов между списками: splice не копирует значения и не выделяет
+// память, поэтому allocs/op должен быть нулевым
+template <typename List, typename Build>
+void BenchSplice(const rpc_bench::Case &c, const char *impl, Build &build) {
+  constexpr size_t kChunk = 64;
+  using Lists = std::pair<List, List>;
+  auto pair = [&] { return Lists(build(), List()); };
+  rpc_bench::Run(c, "splice_chunks", impl, pair, [&](Lists &p) {
+    while (!p.first.empty()) {
+      auto last = p.first.begin();
+      for (size_t i = 0; i < kChunk && last != p.first.end(); ++i) ++last;
+      p.second.splice(p.second.end(), p.first, p.first.begin(), last);
+    }
+    rpc_bench::Consume(p.second.size());
+  });
+  rpc_bench::Run(c, "splice_whole", impl, pair, [&](Lists &p) {
+    for (size_t i = 0; i < c.n; ++i) {
+      p.second.splice(p.second.begin(), p.first);
+      p.first.splice(p.first.end(), p.second);
+    }
+    rpc_bench::Consume(p.first.size());
+  });
+  rpc_bench::Run(c, "reverse", impl, build, [](List &list) { list.reverse(); });
+  // слияние двух отсортированных половин
+  auto halves = [&] {
+    Lists lists(build(), List());
+    lists.second.splice(lists.second.begin(), lists.first);
+    for (size_t i = 0; i < c.n / 2; ++i) {
+      lists.first.splice(lists.first.end(), lists.second,
+                         lists.second.begin());
+    }
+    lists.first.sort();
+    lists.second.sort();
+    return lists;
+  };
+  rpc_bench::Run(c, "merge", impl, halves, [](Lists &p) {
+    p.first.merge(p.second);
+    rpc_bench::Consume(p.first.size());
+  });
+}
+
+template <typename List>
+void BenchSequence(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  auto build = [&] {
+    List list;
+    for (int key : keys) list.push_back(key);
+    return list;
+  };
+  rpc_bench::Run(
+      c, "push_back", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { build(); });
+  rpc_bench::Run(c, "iterate", impl, build, [](List &list) {
+    long long sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it;
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "copy", impl, build, [](List &list) {
+    List copy(list);
+    rpc_bench::Consume(copy.size());
+  });
+  rpc_bench::Run(c, "pop_front", impl, build, [](List &list) {
+    while (!list.empty()) list.pop_front();
+  });
+  rpc_bench::Run(c, "sort", impl, build, [](List &list) { list.sort(); });
+  BenchSplice<List>(c, impl, build);
+}
+
+}  // namespace
+
+void rpc_bench::BenchList(const Case &c) {
+  BenchSequence<rpc::list<int>>(c, "rpc::list");
+  BenchSequence<std::list<int>>(c, "std::list");
+}
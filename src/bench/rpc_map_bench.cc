@@ -0,0 +1,50 @@
+#include "rpc_bench.h"
+
+namespace {
+
+int Value(std::map<int, int>::iterator it) { return it->second; }
+
+int Value(rpc::map<int, int>::iterator it) { return it.m_node->data; }
+
+template <typename Map>
+void BenchContainer(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  auto build = [&] {
+    Map map;
+    for (int key : keys) map[key] = key;
+    return map;
+  };
+  rpc_bench::Run(
+      c, "insert", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { build(); });
+  rpc_bench::Run(c, "lookup", impl, build, [&](Map &map) {
+    long long sum = 0;
+    for (int key : *c.lookups) {
+      auto it = map.find(key);
+      if (it != map.end()) sum += Value(it);
+    }
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "iterate", impl, build, [](Map &map) {
+    long long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) sum += Value(it);
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "copy", impl, build, [](Map &map) {
+    Map copy(map);
+    rpc_bench::Consume(copy.size());
+  });
+  rpc_bench::Run(c, "erase", impl, build, [&](Map &map) {
+    for (int key : keys) {
+      auto it = map.find(key);
+      if (it != map.end()) map.erase(it);
+    }
+  });
+}
+
+}  // namespace
+
+void rpc_bench::BenchMap(const Case &c) {
+  BenchContainer<rpc::map<int, int>>(c, "rpc::map");
+  BenchContainer<std::map<int, int>>(c, "std::map");
+}
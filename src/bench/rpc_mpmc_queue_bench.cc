@@ -0,0 +1,75 @@
+#include <string>
+#include <thread>
+
+#include "rpc_bench.h"
+
+namespace {
+
+const size_t kCapacity = 1024;
+const size_t kThreads[] = {1, 2, 4, 8, 16, 32, 64};
+
+// Передача n элементов через очередь при threads потоках: половина -
+// производители, половина - потребители. Один поток по очереди кладет и
+// забирает элемент, это стоимость операций без конкуренции
+template <typename Queue>
+void Transfer(Queue &queue, size_t n, size_t threads) {
+  if (threads == 1) {
+    long long sum = 0, value = 0;
+    for (size_t i = 0; i < n; ++i) {
+      queue.try_push(static_cast<long long>(i));
+      queue.try_pop(value);
+      sum += value;
+    }
+    rpc_bench::Consume(sum);
+    return;
+  }
+  const size_t producers = threads / 2, consumers = threads - producers;
+  std::vector<std::thread> workers;
+  workers.reserve(threads);
+  for (size_t p = 0; p < producers; ++p) {
+    workers.emplace_back([&queue, n, producers, p] {
+      rpc_bench::PinThread(static_cast<unsigned>(p));
+      for (size_t i = p; i < n; i += producers) {
+        while (!queue.try_push(static_cast<long long>(i))) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (size_t k = 0; k < consumers; ++k) {
+    workers.emplace_back([&queue, n, producers, consumers, k] {
+      rpc_bench::PinThread(static_cast<unsigned>(producers + k));
+      long long sum = 0, value;
+      for (size_t i = k; i < n; i += consumers) {
+        while (!queue.try_pop(value)) std::this_thread::yield();
+        sum += value;
+      }
+      rpc_bench::Consume(sum);
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+}
+
+// make создает очередь для каждого замера
+template <typename Make>
+void BenchScaling(const rpc_bench::Case &c, const char *impl, Make make) {
+  using Queue = typename decltype(make())::element_type;
+  for (size_t threads : kThreads) {
+    std::string op = "transfer_t" + std::to_string(threads);
+    rpc_bench::Run(
+        c, op.c_str(), impl, make, [&](std::unique_ptr<Queue> &queue) {
+          Transfer(*queue, c.n, threads);
+        });
+  }
+}
+
+}  // namespace
+
+void rpc_bench::BenchMpmcQueue(const Case &c) {
+  if (!IsFirstDistribution(c)) return;
+  BenchScaling(c, "rpc::mpmc_queue", [] {
+    return std::make_unique<rpc::mpmc_queue<long long>>(kCapacity);
+  });
+  BenchScaling(c, "rpc::queue+mutex",
+               [] { return std::make_unique<LockedQueue>(); });
+}
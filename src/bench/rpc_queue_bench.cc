@@ -0,0 +1,35 @@
+#include "rpc_bench.h"
+
+namespace {
+
+template <typename Queue>
+void BenchContainer(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  auto build = [&] {
+    Queue queue;
+    for (int key : keys) queue.push(key);
+    return queue;
+  };
+  rpc_bench::Run(
+      c, "push", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { build(); });
+  rpc_bench::Run(c, "copy", impl, build, [](Queue &queue) {
+    Queue copy(queue);
+    rpc_bench::Consume(copy.size());
+  });
+  rpc_bench::Run(c, "front_pop", impl, build, [](Queue &queue) {
+    long long sum = 0;
+    while (!queue.empty()) {
+      sum += queue.front();
+      queue.pop();
+    }
+    rpc_bench::Consume(sum);
+  });
+}
+
+}  // namespace
+
+void rpc_bench::BenchQueue(const Case &c) {
+  BenchContainer<rpc::queue<int>>(c, "rpc::queue");
+  BenchContainer<std::queue<int>>(c, "std::queue");
+}
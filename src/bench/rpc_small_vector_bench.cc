@@ -0,0 +1,44 @@
+#include "rpc_bench.h"
+
+namespace {
+
+// Короткоживущие векторы по запросу: на каждый ключ собирается вектор из
+// 1..8 элементов. small_vector<int, 8> не обращается к аллокатору вовсе
+template <typename Vector>
+void BenchShortLived(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  rpc_bench::Run(
+      c, "short_lived", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) {
+        long long sum = 0;
+        for (int key : keys) {
+          Vector vector;
+          for (int i = 0; i <= (key & 7); ++i) vector.push_back(key + i);
+          for (int value : vector) sum += value;
+        }
+        rpc_bench::Consume(sum);
+      });
+}
+
+template <typename Vector>
+void BenchSpill(const rpc_bench::Case &c, const char *impl) {
+  auto none = [] { return rpc_bench::NoState(); };
+  rpc_bench::Run(c, "push_back", impl, none, [&](rpc_bench::NoState &) {
+    Vector vector;
+    for (int key : *c.keys) vector.push_back(key);
+    rpc_bench::Consume(vector.size());
+  });
+}
+
+}  // namespace
+
+void rpc_bench::BenchSmallVector(const Case &c) {
+  if (c.n == 0) return;
+  BenchShortLived<rpc::small_vector<int, 8>>(c, "rpc::small_vector<8>");
+  BenchShortLived<rpc::vector<int>>(c, "rpc::vector");
+  BenchShortLived<std::vector<int>>(c, "std::vector");
+  if (IsFirstDistribution(c)) {
+    BenchSpill<rpc::small_vector<int, 8>>(c, "rpc::small_vector<8>");
+    BenchSpill<rpc::vector<int>>(c, "rpc::vector");
+  }
+}
@@ -0,0 +1,128 @@
+#include <atomic>
+#include <thread>
+
+#include "rpc_bench.h"
+
+namespace {
+
+const size_t kCapacity = 1024;
+const size_t kBatch = 64;
+const size_t kLatencySamples = 100000;
+
+using SpscQueue = rpc::spsc_queue<long long, kCapacity>;
+
+long long Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Производитель и потребитель на разных процессорах. Оба работают в своих
+// потоках: привязка основного потока к процессору осталась бы и для
+// следующих замеров
+template <typename Produce, typename Consume>
+void RunPair(Produce &&produce, Consume &&consume) {
+  std::thread consumer([&] {
+    rpc_bench::PinThread(1);
+    consume();
+  });
+  std::thread producer([&] {
+    rpc_bench::PinThread(0);
+    produce();
+  });
+  producer.join();
+  consumer.join();
+}
+
+template <typename Queue>
+void BenchTransfer(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  rpc_bench::Run(
+      c, "transfer", impl, [] { return std::make_unique<Queue>(); },
+      [&](std::unique_ptr<Queue> &queue) {
+        long long sum = 0;
+        RunPair(
+            [&] {
+              for (int key : keys) {
+                while (!queue->try_push(key)) std::this_thread::yield();
+              }
+            },
+            [&] {
+              long long value;
+              for (size_t i = 0; i < keys.size(); ++i) {
+                while (!queue->try_pop(value)) std::this_thread::yield();
+                sum += value;
+              }
+            });
+        rpc_bench::Consume(sum);
+      });
+}
+
+// Один элемент в полете: производитель ждет, пока потребитель заберет
+// предыдущий, поэтому задержка не включает время ожидания в очереди
+template <typename Queue>
+void BenchLatency(const rpc_bench::Case &c, const char *impl) {
+  const size_t n = std::min(c.n, kLatencySamples);
+  std::vector<double> samples;
+  samples.reserve(n);
+  Queue queue;
+  std::atomic<size_t> received{0};
+  RunPair(
+      [&] {
+        for (size_t i = 0; i < n; ++i) {
+          queue.try_push(Now());
+          while (received.load(std::memory_order_acquire) <= i) {
+            std::this_thread::yield();
+          }
+        }
+      },
+      [&] {
+        long long stamp;
+        for (size_t i = 0; i < n; ++i) {
+          while (!queue.try_pop(stamp)) std::this_thread::yield();
+          samples.push_back(static_cast<double>(Now() - stamp));
+          received.store(i + 1, std::memory_order_release);
+        }
+      });
+  rpc_bench::RecordLatencies(c, "latency", impl, samples);
+}
+
+void BenchBatch(const rpc_bench::Case &c) {
+  const std::vector<int> &keys = *c.keys;
+  rpc_bench::Run(
+      c, "transfer_batch", "rpc::spsc_queue",
+      [] { return std::make_unique<SpscQueue>(); },
+      [&](std::unique_ptr<SpscQueue> &queue) {
+        long long sum = 0;
+        RunPair(
+            [&] {
+              for (size_t i = 0; i < keys.size();) {
+                size_t count = std::min(kBatch, keys.size() - i);
+                size_t pushed = queue->push_n(keys.begin() + i, count);
+                if (!pushed) std::this_thread::yield();
+                i += pushed;
+              }
+            },
+            [&] {
+              long long batch[kBatch];
+              for (size_t i = 0; i < keys.size();) {
+                size_t popped = queue->pop_n(batch, kBatch);
+                if (!popped) std::this_thread::yield();
+                for (size_t k = 0; k < popped; ++k) sum += batch[k];
+                i += popped;
+              }
+            });
+        rpc_bench::Consume(sum);
+      });
+}
+
+}  // namespace
+
+void rpc_bench::BenchSpscQueue(const Case &c) {
+  if (!IsFirstDistribution(c)) return;
+  BenchTransfer<SpscQueue>(c, "rpc::spsc_queue");
+  BenchTransfer<rpc_bench::LockedQueue>(c, "rpc::queue+mutex");
+  BenchBatch(c);
+  BenchLatency<SpscQueue>(c, "rpc::spsc_queue");
+  BenchLatency<rpc_bench::LockedQueue>(c, "rpc::queue+mutex");
+}
@@ -0,0 +1,36 @@
+#include "rpc_bench.h"
+
+namespace {
+
+template <typename Stack>
+void BenchContainer(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  auto build = [&] {
+    Stack stack;
+    for (int key : keys) stack.push(key);
+    return stack;
+  };
+  rpc_bench::Run(
+      c, "push", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { build(); });
+  rpc_bench::Run(c, "copy", impl, build, [](Stack &stack) {
+    Stack copy(stack);
+    rpc_bench::Consume(copy.empty());
+  });
+  rpc_bench::Run(c, "top_pop", impl, build, [](Stack &stack) {
+    long long sum = 0;
+    while (!stack.empty()) {
+      sum += stack.top();
+      stack.pop();
+    }
+    rpc_bench::Consume(sum);
+  });
+}
+
+}  // namespace
+
+void rpc_bench::BenchStack(const Case &c) {
+  BenchContainer<rpc::stack<int>>(c, "rpc::stack");
+  BenchContainer<rpc::stack<int, rpc::list<int>>>(c, "rpc::stack<list>");
+  BenchContainer<std::stack<int>>(c, "std::stack");
+}
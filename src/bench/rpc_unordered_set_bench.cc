@@ -0,0 +1,60 @@
+#include <unordered_set>
+
+#include "rpc_bench.h"
+
+namespace {
+
+bool Contains(std::unordered_set<int> &set, int key) {
+  return set.count(key) != 0;
+}
+
+template <typename Set>
+bool Contains(Set &set, int key) {
+  return set.contains(key);
+}
+
+template <typename Set>
+void BenchContainer(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  auto build = [&] {
+    Set set;
+    for (int key : keys) set.insert(key);
+    return set;
+  };
+  rpc_bench::Run(
+      c, "insert", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { build(); });
+  rpc_bench::Run(c, "lookup", impl, build, [&](Set &set) {
+    long long found = 0;
+    for (int key : *c.lookups) found += Contains(set, key);
+    rpc_bench::Consume(found);
+  });
+  rpc_bench::Run(c, "lookup_miss", impl, build, [&](Set &set) {
+    long long found = 0;
+    for (int key : *c.lookups) found += Contains(set, key + c.n);
+    rpc_bench::Consume(found);
+  });
+  rpc_bench::Run(c, "iterate", impl, build, [](Set &set) {
+    long long sum = 0;
+    for (auto it = set.begin(); it != set.end(); ++it) sum += *it;
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "copy", impl, build, [](Set &set) {
+    Set copy(set);
+    rpc_bench::Consume(copy.size());
+  });
+  rpc_bench::Run(c, "erase", impl, build, [&](Set &set) {
+    for (int key : keys) {
+      auto it = set.find(key);
+      if (it != set.end()) set.erase(it);
+    }
+  });
+}
+
+}  // namespace
+
+void rpc_bench::BenchUnorderedSet(const Case &c) {
+  BenchContainer<rpc::unordered_set<int>>(c, "rpc::unordered_set");
+  BenchContainer<std::unordered_set<int>>(c, "std::unordered_set");
+  BenchContainer<rpc::set<int>>(c, "rpc::set");
+}
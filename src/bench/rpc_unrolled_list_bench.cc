@@ -0,0 +1,51 @@
+#include "rpc_bench.h"
+
+namespace {
+
+// Заполнение и обход: главный выигрыш unrolled_list - обход по массивам
+// внутри блоков вместо перехода по указателю на каждый элемент
+template <typename Sequence>
+void BenchTraverse(const rpc_bench::Case &c, const char *impl) {
+  auto build = [&] {
+    Sequence sequence;
+    for (int key : *c.keys) sequence.push_back(key);
+    return sequence;
+  };
+  rpc_bench::Run(
+      c, "push_back", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { rpc_bench::Consume(build().size()); });
+  rpc_bench::Run(c, "iterate", impl, build, [](Sequence &sequence) {
+    long long sum = 0;
+    for (int value : sequence) sum += value;
+    rpc_bench::Consume(sum);
+  });
+}
+
+// Операции на концах списка
+template <typename List>
+void BenchListOps(const rpc_bench::Case &c, const char *impl) {
+  auto build = [&] {
+    List list;
+    for (int key : *c.keys) list.push_front(key);
+    return list;
+  };
+  rpc_bench::Run(
+      c, "push_front", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { rpc_bench::Consume(build().size()); });
+  rpc_bench::Run(c, "pop_front", impl, build, [](List &list) {
+    while (!list.empty()) list.pop_front();
+  });
+}
+
+}  // namespace
+
+void rpc_bench::BenchUnrolledList(const Case &c) {
+  BenchTraverse<rpc::unrolled_list<int>>(c, "rpc::unrolled_list");
+  BenchTraverse<rpc::list<int>>(c, "rpc::list");
+  BenchTraverse<std::list<int>>(c, "std::list");
+  BenchTraverse<rpc::vector<int>>(c, "rpc::vector");
+  if (IsFirstDistribution(c)) {
+    BenchListOps<rpc::unrolled_list<int>>(c, "rpc::unrolled_list");
+    BenchListOps<rpc::list<int>>(c, "rpc::list");
+  }
+}
@@ -0,0 +1,157 @@
+#include <string>
+
+#include "rpc_bench.h"
+
+namespace {
+
+template <typename Vector>
+void BenchSequence(const rpc_bench::Case &c, const char *impl) {
+  const std::vector<int> &keys = *c.keys;
+  auto build = [&] {
+    Vector vector;
+    for (int key : keys) vector.push_back(key);
+    return vector;
+  };
+  rpc_bench::Run(
+      c, "push_back", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) { build(); });
+  // загрузка диапазоном: одно выделение памяти и memcpy вместо n push_back
+  rpc_bench::Run(
+      c, "bulk_load", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) {
+        Vector vector(keys.begin(), keys.end());
+        rpc_bench::Consume(vector.size());
+      });
+  rpc_bench::Run(
+      c, "insert_range", impl,
+      [&] { return Vector(keys.begin() + keys.size() / 2, keys.end()); },
+      [&](Vector &vector) {
+        vector.insert(vector.begin(), keys.begin(),
+                      keys.begin() + keys.size() / 2);
+        rpc_bench::Consume(vector.size());
+      });
+  rpc_bench::Run(c, "lookup", impl, build, [&](Vector &vector) {
+    long long sum = 0;
+    for (int key : *c.lookups) sum += vector[key % keys.size()];
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "iterate", impl, build, [](Vector &vector) {
+    long long sum = 0;
+    for (auto it = vector.begin(); it != vector.end(); ++it) sum += *it;
+    rpc_bench::Consume(sum);
+  });
+  rpc_bench::Run(c, "copy", impl, build, [](Vector &vector) {
+    Vector copy(vector);
+    rpc_bench::Consume(copy.size());
+  });
+  rpc_bench::Run(c, "pop_back", impl, build, [](Vector &vector) {
+    while (!vector.empty()) vector.pop_back();
+  });
+}
+
+// Сборка вектора строк: рост хранилища переносит строки, а не копирует их
+void BenchStringBuilder(const rpc_bench::Case &c) {
+  const std::string pattern(64, 'x');
+  auto none = [] { return rpc_bench::NoState(); };
+  rpc_bench::Run(c, "string_copy", "rpc::vector", none,
+                 [&](rpc_bench::NoState &) {
+                   rpc::vector<std::string> vector;
+                   for (size_t i = 0; i < c.n; ++i) vector.push_back(pattern);
+                 });
+  rpc_bench::Run(c, "string_move", "rpc::vector", none,
+                 [&](rpc_bench::NoState &) {
+                   rpc::vector<std::string> vector;
+                   for (size_t i = 0; i < c.n; ++i) {
+                     std::string value(pattern);
+                     vector.push_back(std::move(value));
+                   }
+                 });
+  rpc_bench::Run(c, "string_emplace", "rpc::vector", none,
+                 [&](rpc_bench::NoState &) {
+                   rpc::vector<std::string> vector;
+                   for (size_t i = 0; i < c.n; ++i) vector.emplace_back(64, 'x');
+                 });
+  rpc_bench::Run(c, "string_emplace", "std::vector", none,
+                 [&](rpc_bench::NoState &) {
+                   std::vector<std::string> vector;
+                   for (size_t i = 0; i < c.n; ++i) vector.emplace_back(64, 'x');
+                 });
+}
+
+// Численное ядро y[i] += a * x[i] с доступом по индексу: без проверки
+// границ в operator[] цикл векторизуется
+template <typename Vector>
+void BenchKernel(const rpc_bench::Case &c, const char *impl) {
+  auto setup = [&] {
+    std::pair<Vector, Vector> xy;
+    for (size_t i = 0; i < c.n; ++i) {
+      xy.first.push_back(static_cast<double>(i));
+      xy.second.push_back(1.0);
+    }
+    return xy;
+  };
+  rpc_bench::Run(c, "axpy", impl, setup, [&](std::pair<Vector, Vector> &xy) {
+    const Vector &x = xy.first;
+    Vector &y = xy.second;
+    for (size_t i = 0; i < c.n; ++i) y[i] += 0.5 * x[i];
+    rpc_bench::Consume(static_cast<long long>(y[c.n - 1]));
+  });
+}
+
+// push_back с разными правилами роста: allocs/op показывает долю
+// перевыделений
+template <typename Growth>
+void BenchGrowth(const rpc_bench::Case &c, const char *impl) {
+  rpc_bench::Run(
+      c, "push_back_growth", impl, [] { return rpc_bench::NoState(); },
+      [&](rpc_bench::NoState &) {
+        rpc::vector<int, std::allocator<int>, Growth> vector;
+        for (size_t i = 0; i < c.n; ++i) vector.push_back(static_cast<int>(i));
+        rpc_bench::Consume(vector.capacity());
+      });
+}
+
+// Вставка и удаление в начале вектора из n элементов: каждая операция
+// сдвигает весь хвост. В ns/op - время одной операции, как в RecordLatencies
+template <typename Vector, typename Value>
+void BenchFrontShift(const rpc_bench::Case &c, const char *impl,
+                     const Value &value) {
+  constexpr size_t kOps = 64;
+  Vector vector;
+  for (size_t i = 0; i < c.n; ++i) vector.push_back(value);
+  vector.reserve(c.n + kOps);
+  double insert = rpc_bench::Measure([&] {
+    for (size_t i = 0; i < kOps; ++i) vector.insert(vector.begin(), value);
+  });
+  double erase = rpc_bench::Measure([&] {
+    for (size_t i = 0; i < kOps; ++i) vector.erase(vector.begin());
+  });
+  rpc_bench::Consume(vector.size());
+  const double scale = static_cast<double>(c.n) / kOps;
+  const char *dist = rpc_bench::DistributionName(c.distribution);
+  rpc_bench::Record(rpc_bench::Result{c.suite, "insert_front", impl, dist,
+                                      c.n, insert * scale, 0});
+  rpc_bench::Record(rpc_bench::Result{c.suite, "erase_front", impl, dist, c.n,
+                                      erase * scale, 0});
+}
+
+}  // namespace
+
+void rpc_bench::BenchVector(const Case &c) {
+  if (c.n == 0) return;
+  BenchSequence<rpc::vector<int>>(c, "rpc::vector");
+  BenchSequence<std::vector<int>>(c, "std::vector");
+  if (IsFirstDistribution(c)) {
+    BenchStringBuilder(c);
+    BenchKernel<rpc::vector<double>>(c, "rpc::vector");
+    BenchKernel<std::vector<double>>(c, "std::vector");
+    BenchGrowth<rpc::growth_2x>(c, "rpc::vector 2x");
+    BenchGrowth<rpc::growth_1_5x>(c, "rpc::vector 1.5x");
+    BenchGrowth<rpc::fixed_growth<4096>>(c, "rpc::vector +4096");
+    const std::string word(16, 'x');
+    BenchFrontShift<rpc::vector<int>>(c, "rpc::vector<int>", 1);
+    BenchFrontShift<std::vector<int>>(c, "std::vector<int>", 1);
+    BenchFrontShift<rpc::vector<std::string>>(c, "rpc::vector<string>", word);
+    BenchFrontShift<std::vector<std::string>>(c, "std::vector<string>", word);
+  }
+}
@@ -0,0 +1,273 @@
+#ifndef RPC_ALLOCATOR_H
+#define RPC_ALLOCATOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rpc {
+
+/// @brief Пул блоков фиксированного размера для узлов контейнеров.
+/// Память берётся у системы слэбами по kSlabBytes байт и нарезается на блоки.
+/// Каждый поток держит небольшой кэш свободных блоков, поэтому обычные
+/// выделение и освобождение не требуют синхронизации. Кэш ограничен
+/// kMaxCached блоками: излишек уходит пачками в общий lock-free список пула,
+/// откуда его забирают потоки с пустым кэшем. При завершении потока его кэш
+/// целиком сбрасывается в общий список. Так блок, освобождённый в чужом
+/// потоке, возвращается в пул, и память ограничена пиком живых блоков.
+/// Слэбы не возвращаются системе до завершения процесса, поэтому узлы
+/// остаются валидными при любом порядке уничтожения статических объектов.
+/// @tparam Size размер блока
+/// @tparam Align выравнивание блока
+template <std::size_t Size, std::size_t Align>
+class fixed_block_pool {
+ public:
+  /// @brief Выделяет один блок
+  /// @return указатель на неинициализированный блок
+  static void *allocate() {
+    ThreadCache &cache = thread_cache();
+    if (!cache.head) acquire(cache);
+    FreeBlock *block = cache.head;
+    cache.head = block->next;
+    --cache.count;
+    if (cache.exited && cache.count) release(cache, cache.count);
+    return block;
+  }
+
+  /// @brief Возвращает блок в кэш текущего потока, излишек кэша - в общий
+  /// список пула
+  /// @param ptr блок, ранее полученный из allocate() в любом потоке
+  static void deallocate(void *ptr) noexcept {
+    FreeBlock *block = static_cast<FreeBlock *>(ptr);
+    ThreadCache &cache = thread_cache();
+    if (!cache.registered) register_thread(cache);
+    block->next = cache.head;
+    cache.head = block;
+    ++cache.count;
+    if (cache.exited) {
+      release(cache, cache.count);
+    } else if (cache.count > kMaxCached) {
+      release(cache, kReleaseBatch);
+    }
+  }
+
+  /// @brief Число слэбов, выделенных пулом с начала работы процесса
+  static std::size_t slab_count() noexcept {
+    return slabs_allocated().load(std::memory_order_relaxed);
+  }
+
+ private:
+  /// @brief Свободный блок хранит ссылку на следующий свободный блок
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  /// @brief Заголовок слэба, связывает все выделенные слэбы в один список
+  struct SlabHeader {
+    SlabHeader *next;
+  };
+
+  /// @brief Кэш свободных блоков потока. Тривиально разрушаем, поэтому
+  /// остаётся доступным и из деструкторов других thread_local объектов
+  struct ThreadCache {
+    FreeBlock *head;
+    std::size_t count;
+    bool registered;
+    bool exited;
+  };
+
+  /// @brief При завершении потока сбрасывает его кэш в общий список
+  struct ThreadExit {
+    ~ThreadExit() {
+      ThreadCache &cache = thread_cache();
+      cache.exited = true;
+      if (cache.count) release(cache, cache.count);
+    }
+  };
+
+  static constexpr std::size_t Max(std::size_t a, std::size_t b) {
+    return a > b ? a : b;
+  }
+  static constexpr std::size_t RoundUp(std::size_t n, std::size_t align) {
+    return (n + align - 1) / align * align;
+  }
+
+  static constexpr std::size_t kBlockAlign = Max(Align, alignof(FreeBlock));
+  static constexpr std::size_t kBlockSize =
+      RoundUp(Max(Size, sizeof(FreeBlock)), kBlockAlign);
+  static constexpr std::size_t kHeaderSize =
+      RoundUp(sizeof(SlabHeader), kBlockAlign);
+  static constexpr std::size_t kSlabBytes = 64 * 1024;
+  static constexpr std::size_t kBlocksPerSlab =
+      Max((kSlabBytes - kHeaderSize) / kBlockSize, 1);
+  static constexpr std::size_t kMaxCached = kBlocksPerSlab;
+  static constexpr std::size_t kReleaseBatch = Max(kMaxCached / 2, 1);
+
+  static ThreadCache &thread_cache() noexcept {
+    static thread_local ThreadCache cache{nullptr, 0, false, false};
+    return cache;
+  }
+
+  /// @brief Общий список свободных блоков пула. В него только добавляют
+  /// цепочки через CAS и забирают его целиком через exchange, поэтому
+  /// проблемы ABA здесь нет
+  static std::atomic<FreeBlock *> &shared_list() noexcept {
+    static std::atomic<FreeBlock *> head{nullptr};
+    return head;
+  }
+
+  static std::atomic<std::size_t> &slabs_allocated() noexcept {
+    static std::atomic<std::size_t> count{0};
+    return count;
+  }
+
+  /// @brief Заводит потоку объект, который сбросит кэш при выходе
+  static void register_thread(ThreadCache &cache) noexcept {
+    cache.registered = true;
+    static thread_local ThreadExit on_exit;
+    (void)on_exit;
+  }
+
+  /// @brief Переносит n первых блоков кэша потока в общий список
+  static void release(ThreadCache &cache, std::size_t n) noexcept {
+    FreeBlock *first = cache.head;
+    FreeBlock *last = first;
+    for (std::size_t i = 1; i < n; ++i) last = last->next;
+    cache.head = last->next;
+    cache.count -= n;
+    std::atomic<FreeBlock *> &shared = shared_list();
+    last->next = shared.load(std::memory_order_relaxed);
+    while (!shared.compare_exchange_weak(last->next, first,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+    }
+  }
+
+  /// @brief Наполняет пустой кэш потока: забирает общий список целиком, а
+  /// если он пуст - выделяет новый слэб
+  static void acquire(ThreadCache &cache) {
+    if (!cache.registered) register_thread(cache);
+    FreeBlock *head = shared_list().exchange(nullptr, std::memory_order_acquire);
+    if (!head) {
+      refill(cache);
+      return;
+    }
+    std::size_t count = 0;
+    for (FreeBlock *block = head; block; block = block->next) ++count;
+    cache.head = head;
+    cache.count = count;
+  }
+
+  /// @brief Выделяет новый слэб и кладёт все его блоки в кэш потока
+  /// @param cache пустой кэш текущего потока
+  static void refill(ThreadCache &cache) {
+    const std::size_t bytes = kHeaderSize + kBlocksPerSlab * kBlockSize;
+    char *slab;
+    if constexpr (kBlockAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+      slab = static_cast<char *>(
+          ::operator new(bytes, std::align_val_t(kBlockAlign)));
+    } else {
+      slab = static_cast<char *>(::operator new(bytes));
+    }
+    SlabHeader *header = reinterpret_cast<SlabHeader *>(slab);
+    static std::atomic<SlabHeader *> slabs{nullptr};
+    header->next = slabs.load(std::memory_order_relaxed);
+    while (!slabs.compare_exchange_weak(header->next, header,
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+    }
+    slabs_allocated().fetch_add(1, std::memory_order_relaxed);
+    char *blocks = slab + kHeaderSize;
+    for (std::size_t i = kBlocksPerSlab; i-- > 0;) {
+      FreeBlock *block = reinterpret_cast<FreeBlock *>(blocks + i * kBlockSize);
+      block->next = cache.head;
+      cache.head = block;
+    }
+    cache.count += kBlocksPerSlab;
+  }
+};
+
+/// @brief Аллокатор по умолчанию для узловых контейнеров (list, set, map).
+/// Одиночные объекты берутся из fixed_block_pool, массивы - из
+/// std::allocator. Не имеет состояния, все экземпляры взаимозаменяемы.
+/// @tparam T тип выделяемых объектов
+template <typename T>
+class pool_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  pool_allocator() noexcept = default;
+  template <typename U>
+  pool_allocator(const pool_allocator<U> &) noexcept {}
+
+  /// @brief Выделяет память под n объектов
+  /// @param n количество объектов
+  /// @return указатель на неинициализированную память
+  T *allocate(size_type n) {
+    if (n == 1) return static_cast<T *>(pool::allocate());
+    return std::allocator<T>().allocate(n);
+  }
+
+  /// @brief Освобождает память, выделенную allocate(n)
+  /// @param ptr указатель на память
+  /// @param n количество объектов, переданное в allocate
+  void deallocate(T *ptr, size_type n) noexcept {
+    if (n == 1)
+      pool::deallocate(ptr);
+    else
+      std::allocator<T>().deallocate(ptr, n);
+  }
+
+ private:
+  using pool = fixed_block_pool<sizeof(T), alignof(T)>;
+};
+
+template <typename T, typename U>
+bool operator==(const pool_allocator<T> &, const pool_allocator<U> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const pool_allocator<T> &, const pool_allocator<U> &) noexcept {
+  return false;
+}
+
+/// @brief Выделяет и конструирует узел контейнера через аллокатор узлов
+/// @tparam Node тип узла
+/// @tparam NodeAllocator аллокатор, value_type которого - Node
+/// @param alloc аллокатор
+/// @param ...args аргументы конструктора узла
+/// @return указатель на новый узел
+template <typename Node, typename NodeAllocator, typename... Args>
+Node *create_node(NodeAllocator &alloc, Args &&...args) {
+  using traits = std::allocator_traits<NodeAllocator>;
+  Node *node = traits::allocate(alloc, 1);
+  try {
+    traits::construct(alloc, node, std::forward<Args>(args)...);
+  } catch (...) {
+    traits::deallocate(alloc, node, 1);
+    throw;
+  }
+  return node;
+}
+
+/// @brief Разрушает узел и возвращает его память аллокатору
+/// @param alloc аллокатор, которым узел был выделен
+/// @param node узел
+template <typename NodeAllocator, typename Node>
+void destroy_node(NodeAllocator &alloc, Node *node) noexcept {
+  using traits = std::allocator_traits<NodeAllocator>;
+  traits::destroy(alloc, node);
+  traits::deallocate(alloc, node, 1);
+}
+
+}  // namespace rpc
+
+#endif  // RPC_ALLOCATOR_H
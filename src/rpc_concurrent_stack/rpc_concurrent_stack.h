@@ -0,0 +1,182 @@
+#ifndef RPC_CONCURRENT_STACK_H
+#define RPC_CONCURRENT_STACK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace rpc {
+
+/// @brief Стек Трайбера: односвязный список узлов, вершина которого меняется
+/// через CAS, без блокировок для любого числа потоков.
+/// Снятые узлы не освобождаются, а попадают в список свободных узлов (такой
+/// же стек Трайбера) и используются повторно, поэтому push не обращается к
+/// аллокатору, пока есть свободные узлы, а поток, прочитавший устаревшую
+/// вершину, всегда читает живую память. Узлы возвращаются аллокатору в
+/// деструкторе.
+/// Защита от ABA: в старших 16 битах указателя на вершину хранится счетчик
+/// изменений, CAS со старой вершиной не пройдет, даже если узел успел
+/// вернуться на вершину. Это предполагает 48-битные адреса (x86-64,
+/// AArch64) и не ловит ровно 65536 изменений между чтением и CAS.
+/// size() и top() нет: их результат устаревает до возврата.
+/// @tparam T тип элементов
+/// @tparam Allocator аллокатор узлов, вызывается из разных потоков
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_stack {
+  static_assert(sizeof(void *) == sizeof(uint64_t),
+                "concurrent_stack packs a tag into 64-bit pointers");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  concurrent_stack() = default;
+  concurrent_stack(const concurrent_stack &) = delete;
+  concurrent_stack &operator=(const concurrent_stack &) = delete;
+
+  /// @brief Деструктор, вызывается, когда потоки закончили работу со стеком
+  ~concurrent_stack() {
+    for (Node *node = ptr(_top.load(std::memory_order_relaxed)); node;) {
+      Node *next = node->next.load(std::memory_order_relaxed);
+      node->value()->~value_type();
+      deallocate_node(_alloc, node);
+      node = next;
+    }
+    for (Node *node = ptr(_free.load(std::memory_order_relaxed)); node;) {
+      Node *next = node->next.load(std::memory_order_relaxed);
+      deallocate_node(_alloc, node);
+      node = next;
+    }
+  }
+
+  /// @brief Кладет элемент на вершину стека
+  /// @param value значение
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+
+  /// @brief Создает элемент на вершине стека
+  /// @param ...args аргументы конструктора элемента
+  template <typename... Args>
+  void emplace(Args &&...args) {
+    Node *node = pop_node(_free);
+    if (!node) node = allocate_node(_alloc);
+    try {
+      new (node->storage) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      push_node(_free, node);
+      throw;
+    }
+    push_node(_top, node);
+  }
+
+  /// @brief Снимает элемент с вершины стека
+  /// @param value куда переместить элемент
+  /// @return false, если стек пуст
+  bool try_pop(reference value) {
+    Node *node = pop_node(_top);
+    if (!node) return false;
+    value_type *slot = node->value();
+    try {
+      value = std::move(*slot);
+    } catch (...) {
+      push_node(_top, node);
+      throw;
+    }
+    slot->~value_type();
+    push_node(_free, node);
+    return true;
+  }
+
+  /// @brief Проверяет стек на пустоту. Результат может устареть сразу
+  /// после возврата
+  bool empty() const { return !ptr(_top.load(std::memory_order_acquire)); }
+
+  /// @brief Заранее создает count свободных узлов, чтобы следующие push не
+  /// обращались к аллокатору
+  /// @param count число узлов
+  void reserve(size_type count) {
+    for (size_type i = 0; i < count; ++i) {
+      push_node(_free, allocate_node(_alloc));
+    }
+  }
+
+ private:
+  /// @brief Размер кэш-линии, по которому разносятся вершины
+  static constexpr size_t kCacheLineSize = 64;
+
+  static constexpr int kTagShift = 48;
+  static constexpr uint64_t kPointerMask = (uint64_t{1} << kTagShift) - 1;
+
+  struct Node {
+    value_type *value() {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+
+    /// атомарный: поток с устаревшей вершиной читает next, пока узел
+    /// используется повторно
+    std::atomic<Node *> next{nullptr};
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+  };
+
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  /// @brief Вершина списка: указатель на узел и счетчик изменений
+  using tagged_ptr = uint64_t;
+
+  static Node *ptr(tagged_ptr value) {
+    return reinterpret_cast<Node *>(value & kPointerMask);
+  }
+  static tagged_ptr next_tag(Node *node, tagged_ptr old) {
+    return reinterpret_cast<uintptr_t>(node) |
+           (((old >> kTagShift) + 1) << kTagShift);
+  }
+
+  static Node *allocate_node(node_allocator &alloc) {
+    Node *node = node_traits::allocate(alloc, 1);
+    node_traits::construct(alloc, node);
+    return node;
+  }
+  static void deallocate_node(node_allocator &alloc, Node *node) noexcept {
+    node_traits::destroy(alloc, node);
+    node_traits::deallocate(alloc, node, 1);
+  }
+
+  static void push_node(std::atomic<tagged_ptr> &head, Node *node) {
+    tagged_ptr old = head.load(std::memory_order_relaxed);
+    do {
+      node->next.store(ptr(old), std::memory_order_relaxed);
+    } while (!head.compare_exchange_weak(old, next_tag(node, old),
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+  }
+
+  static Node *pop_node(std::atomic<tagged_ptr> &head) {
+    tagged_ptr old = head.load(std::memory_order_acquire);
+    for (;;) {
+      Node *node = ptr(old);
+      if (!node) return nullptr;
+      Node *next = node->next.load(std::memory_order_relaxed);
+      if (head.compare_exchange_weak(old, next_tag(next, old),
+                                     std::memory_order_acquire,
+                                     std::memory_order_acquire)) {
+        return node;
+      }
+    }
+  }
+
+  node_allocator _alloc;
+  alignas(kCacheLineSize) std::atomic<tagged_ptr> _top{0};
+  alignas(kCacheLineSize) std::atomic<tagged_ptr> _free{0};
+};
+
+}  // namespace rpc
+
+#endif  // RPC_CONCURRENT_STACK_H
@@ -1,11 +1,20 @@
 #ifndef _RPC_CONTAINERS_H_
 #define _RPC_CONTAINERS_H_
 
+#include "rpc_allocator/rpc_allocator.h"
+#include "rpc_concurrent_stack/rpc_concurrent_stack.h"
+#include "rpc_intrusive_list/rpc_intrusive_list.h"
 #include "rpc_list/rpc_list.h"
 #include "rpc_map/rpc_map.h"
+#include "rpc_mpmc_queue/rpc_mpmc_queue.h"
 #include "rpc_queue/rpc_queue.h"
 #include "rpc_set/rpc_set.h"
+#include "rpc_small_vector/rpc_small_vector.h"
+#include "rpc_spsc_queue/rpc_spsc_queue.h"
 #include "rpc_stack/rpc_stack.h"
+#include "rpc_unordered_map/rpc_unordered_map.h"
+#include "rpc_unordered_set/rpc_unordered_set.h"
+#include "rpc_unrolled_list/rpc_unrolled_list.h"
 #include "rpc_vector/rpc_iterators.h"  // vector iterators
 #include "rpc_vector/rpc_vector.h"
 
@@ -0,0 +1,136 @@
+#ifndef RPC_HASH_GROUP_H_
+#define RPC_HASH_GROUP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if !defined(RPC_HASH_NO_SIMD) && defined(__AVX2__)
+#include <immintrin.h>
+#define RPC_HASH_GROUP_AVX2 1
+#elif !defined(RPC_HASH_NO_SIMD) && defined(__SSE2__)
+#include <emmintrin.h>
+#define RPC_HASH_GROUP_SSE2 1
+#endif
+
+namespace rpc {
+
+/// @brief Группа управляющих байт хеш-таблиц с открытой адресацией
+/// (unordered_map, unordered_set). Каждому слоту таблицы соответствует байт:
+/// kEmpty, kDeleted или 7 младших бит хеша занятого слота; после последнего
+/// слота лежит kSentinel, на котором останавливаются итераторы.
+/// Группа из kWidth байт проверяется за одну операцию: AVX2 - 32 байта,
+/// SSE2 - 16 байт, без SIMD - 8 байт в 64-битном слове. Определение
+/// RPC_HASH_NO_SIMD включает скалярный вариант на любой платформе.
+/// Методы Match* возвращают маску, по которой слоты перебираются так:
+///   for (; mask; mask &= mask - 1) index = hash_group::LowestIndex(mask);
+class hash_group {
+ public:
+  using ctrl_t = int8_t;
+  using mask_t = uint64_t;
+
+  static constexpr ctrl_t kEmpty = -128;
+  static constexpr ctrl_t kDeleted = -2;
+  static constexpr ctrl_t kSentinel = -1;
+
+#if defined(RPC_HASH_GROUP_AVX2)
+  static constexpr size_t kWidth = 32;
+
+  explicit hash_group(const ctrl_t *pos)
+      : ctrl_(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(pos))) {}
+
+  /// @brief Слоты, у которых 7 бит хеша равны h2
+  mask_t Match(ctrl_t h2) const {
+    return ToMask(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), ctrl_));
+  }
+  /// @brief Пустые слоты
+  mask_t MatchEmpty() const { return Match(kEmpty); }
+  /// @brief Пустые и удалённые слоты: байты меньше kSentinel
+  mask_t MatchEmptyOrDeleted() const {
+    return ToMask(_mm256_cmpgt_epi8(_mm256_set1_epi8(kSentinel), ctrl_));
+  }
+  /// @brief Номер первого слота группы в непустой маске
+  static size_t LowestIndex(mask_t mask) {
+    return static_cast<size_t>(__builtin_ctzll(mask));
+  }
+
+ private:
+  static mask_t ToMask(__m256i bytes) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(bytes));
+  }
+
+  __m256i ctrl_;
+#elif defined(RPC_HASH_GROUP_SSE2)
+  static constexpr size_t kWidth = 16;
+
+  explicit hash_group(const ctrl_t *pos)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+  /// @brief Слоты, у которых 7 бит хеша равны h2
+  mask_t Match(ctrl_t h2) const {
+    return ToMask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+  }
+  /// @brief Пустые слоты
+  mask_t MatchEmpty() const { return Match(kEmpty); }
+  /// @brief Пустые и удалённые слоты: байты меньше kSentinel
+  mask_t MatchEmptyOrDeleted() const {
+    return ToMask(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_));
+  }
+  /// @brief Номер первого слота группы в непустой маске
+  static size_t LowestIndex(mask_t mask) {
+    return static_cast<size_t>(__builtin_ctzll(mask));
+  }
+
+ private:
+  static mask_t ToMask(__m128i bytes) {
+    return static_cast<uint16_t>(_mm_movemask_epi8(bytes));
+  }
+
+  __m128i ctrl_;
+#else
+  static constexpr size_t kWidth = 8;
+
+  explicit hash_group(const ctrl_t *pos) {
+    std::memcpy(&ctrl_, pos, sizeof(ctrl_));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    ctrl_ = __builtin_bswap64(ctrl_);
+#endif
+  }
+
+  /// @brief Слоты, у которых 7 бит хеша равны h2. Возможны редкие ложные
+  /// совпадения, поэтому ключи всё равно сравниваются
+  mask_t Match(ctrl_t h2) const {
+    uint64_t x = ctrl_ ^ (kLsbs * static_cast<uint8_t>(h2));
+    return (x - kLsbs) & ~x & kMsbs;
+  }
+  /// @brief Пустые слоты: старший бит выставлен, бит 1 сброшен
+  mask_t MatchEmpty() const { return ctrl_ & ~(ctrl_ << 6) & kMsbs; }
+  /// @brief Пустые и удалённые слоты: старший бит выставлен, бит 0 сброшен
+  mask_t MatchEmptyOrDeleted() const { return ctrl_ & ~(ctrl_ << 7) & kMsbs; }
+  /// @brief Номер первого слота группы в непустой маске: в маске выставлен
+  /// старший бит байта слота
+  static size_t LowestIndex(mask_t mask) {
+    return static_cast<size_t>(__builtin_ctzll(mask)) >> 3;
+  }
+
+ private:
+  static constexpr uint64_t kLsbs = 0x0101010101010101ULL;
+  static constexpr uint64_t kMsbs = 0x8080808080808080ULL;
+
+  uint64_t ctrl_;
+#endif
+};
+
+/// @brief Перемешивает биты хеша: std::hash для целых - тождественная
+/// функция, а номер группы и управляющий байт берутся из разных бит
+inline size_t hash_mix(size_t hash) {
+  uint64_t x = hash;
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  return static_cast<size_t>(x);
+}
+
+}  // namespace rpc
+
+#endif  // RPC_HASH_GROUP_H_
@@ -0,0 +1,559 @@
+#ifndef RPC_RAW_HASH_TABLE_H_
+#define RPC_RAW_HASH_TABLE_H_
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "rpc_hash_group.h"
+
+namespace rpc {
+
+template <typename Policy, typename Hash, typename KeyEqual,
+          typename Allocator>
+class raw_hash_table;
+
+/// @brief Итератор по занятым слотам raw_hash_table
+/// @tparam Value тип элемента, const для константного итератора
+template <typename Value>
+class hash_iterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value *;
+  using reference = Value &;
+
+  hash_iterator() : ctrl_(nullptr), slot_(nullptr) {}
+  template <typename Other,
+            typename = std::enable_if_t<std::is_const<Value>::value &&
+                                        !std::is_const<Other>::value>>
+  hash_iterator(const hash_iterator<Other> &other)
+      : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+
+  hash_iterator &operator++() {
+    ++ctrl_;
+    ++slot_;
+    skip_empty();
+    return *this;
+  }
+  hash_iterator operator++(int) {
+    hash_iterator it(*this);
+    ++*this;
+    return it;
+  }
+
+  bool operator==(const hash_iterator &other) const {
+    return ctrl_ == other.ctrl_;
+  }
+  bool operator!=(const hash_iterator &other) const {
+    return ctrl_ != other.ctrl_;
+  }
+
+ private:
+  template <typename, typename, typename, typename>
+  friend class raw_hash_table;
+  template <typename>
+  friend class hash_iterator;
+
+  using ctrl_t = hash_group::ctrl_t;
+
+  hash_iterator(const ctrl_t *ctrl, Value *slot) : ctrl_(ctrl), slot_(slot) {}
+
+  /// @brief Пропускает свободные слоты, байт kSentinel за последним слотом
+  /// останавливает обход
+  void skip_empty() {
+    while (*ctrl_ < hash_group::kSentinel) {
+      ++ctrl_;
+      ++slot_;
+    }
+  }
+
+  const ctrl_t *ctrl_;
+  Value *slot_;
+};
+
+/// @brief Политика raw_hash_table для unordered_map: слот - пара ключ-значение
+template <typename Key, typename T>
+struct hash_map_policy {
+  using key_type = Key;
+  using slot_type = std::pair<const Key, T>;
+
+  static const key_type &key(const slot_type &slot) { return slot.first; }
+
+  template <typename SlotAllocator, typename K, typename... Args>
+  static void construct(SlotAllocator &alloc, slot_type *slot, K &&key,
+                        Args &&...args) {
+    std::allocator_traits<SlotAllocator>::construct(
+        alloc, slot, std::piecewise_construct,
+        std::forward_as_tuple(std::forward<K>(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename K, typename... Args>
+  static slot_type make(K &&key, Args &&...args) {
+    return slot_type(std::piecewise_construct,
+                     std::forward_as_tuple(std::forward<K>(key)),
+                     std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  /// @brief Переносит элемент другой таблицы: ключ константный и копируется,
+  /// значение перемещается
+  template <typename Table>
+  static bool transfer(Table &table, slot_type &slot) {
+    return table.emplace_key(slot.first, std::move(slot.second)).second;
+  }
+};
+
+/// @brief Политика raw_hash_table для unordered_set: слот - сам ключ
+template <typename Key>
+struct hash_set_policy {
+  using key_type = Key;
+  using slot_type = Key;
+
+  static const key_type &key(const slot_type &slot) { return slot; }
+
+  template <typename SlotAllocator, typename K>
+  static void construct(SlotAllocator &alloc, slot_type *slot, K &&key) {
+    std::allocator_traits<SlotAllocator>::construct(alloc, slot,
+                                                    std::forward<K>(key));
+  }
+
+  template <typename K>
+  static slot_type make(K &&key) {
+    return slot_type(std::forward<K>(key));
+  }
+
+  template <typename Table>
+  static bool transfer(Table &table, slot_type &slot) {
+    return table.emplace_key(std::move(slot)).second;
+  }
+};
+
+/// @brief Хеш-таблица с открытой адресацией в стиле Swiss table, общая для
+/// unordered_map и unordered_set. Элементы лежат в плоском массиве слотов,
+/// каждому слоту соответствует управляющий байт: пустой, удалённый или 7
+/// младших бит хеша элемента. Поиск читает сразу группу управляющих байт (см.
+/// hash_group) и сравнивает ключи только у слотов с совпавшими битами хеша.
+/// Элементы не перемещаются до перехеширования, поэтому итераторы и ссылки
+/// валидны до роста таблицы. Контейнеры наследуют таблицу закрыто и сами
+/// решают, какую часть её интерфейса открыть.
+/// @tparam Policy hash_map_policy или hash_set_policy: тип слота, извлечение
+/// ключа и создание слота из ключа и аргументов
+/// @tparam Hash хеш-функция
+/// @tparam KeyEqual сравнение ключей на равенство
+/// @tparam Allocator аллокатор элементов
+template <typename Policy, typename Hash, typename KeyEqual,
+          typename Allocator>
+class raw_hash_table {
+ public:
+  using key_type = typename Policy::key_type;
+  using value_type = typename Policy::slot_type;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+
+ private:
+  using ctrl_t = hash_group::ctrl_t;
+  using slot_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<value_type>;
+  using ctrl_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<ctrl_t>;
+  using slot_traits = std::allocator_traits<slot_allocator>;
+  using ctrl_traits = std::allocator_traits<ctrl_allocator>;
+
+  using Group = hash_group;
+
+  static constexpr ctrl_t kEmpty = hash_group::kEmpty;
+  static constexpr ctrl_t kDeleted = hash_group::kDeleted;
+  static constexpr ctrl_t kSentinel = hash_group::kSentinel;
+  static constexpr size_type kGroupWidth = hash_group::kWidth;
+
+  /// @brief Поиск по ключу другого типа доступен, если и хеш, и сравнение
+  /// объявляют is_transparent
+  template <typename K, typename = void>
+  struct transparent_key {};
+  template <typename K>
+  struct transparent_key<K, std::void_t<typename Hash::is_transparent,
+                                        typename KeyEqual::is_transparent>> {
+    using type = K;
+  };
+
+ public:
+  template <typename K>
+  using transparent_key_t = typename transparent_key<K>::type;
+
+  /// @brief Конструктор по умолчанию, память выделяется при первой вставке
+  raw_hash_table() = default;
+
+  /// @brief Конструктор копирования. Раскладка таблицы копируется как есть,
+  /// без пересчёта хешей
+  /// @param other таблица для копирования
+  raw_hash_table(const raw_hash_table &other)
+      : hash_(other.hash_),
+        eq_(other.eq_),
+        alloc_(slot_traits::select_on_container_copy_construction(
+            other.alloc_)) {
+    if (other.size_ == 0) return;
+    allocate_table(other.capacity_);
+    try {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (other.ctrl_[i] >= 0) {
+          slot_traits::construct(alloc_, slots_ + i, other.slots_[i]);
+          ctrl_[i] = other.ctrl_[i];
+          ++size_;
+        }
+      }
+    } catch (...) {
+      destroy_table();
+      throw;
+    }
+    std::memcpy(ctrl_, other.ctrl_, capacity_);
+    growth_left_ = other.growth_left_;
+  }
+
+  /// @brief Конструктор переноса
+  /// @param other таблица для переноса
+  raw_hash_table(raw_hash_table &&other) noexcept
+      : ctrl_(other.ctrl_),
+        slots_(other.slots_),
+        capacity_(other.capacity_),
+        size_(other.size_),
+        growth_left_(other.growth_left_),
+        hash_(std::move(other.hash_)),
+        eq_(std::move(other.eq_)),
+        alloc_(std::move(other.alloc_)) {
+    other.ctrl_ = nullptr;
+    other.slots_ = nullptr;
+    other.capacity_ = 0;
+    other.size_ = 0;
+    other.growth_left_ = 0;
+  }
+
+  ~raw_hash_table() { destroy_table(); }
+
+  /// @brief Оператор присваивания копированием
+  /// @param other таблица для копирования
+  /// @return ссылка на текущий объект
+  raw_hash_table &operator=(const raw_hash_table &other) {
+    if (this != &other) {
+      raw_hash_table copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  /// @brief Оператор присваивания переносом
+  /// @param other таблица для переноса
+  /// @return ссылка на текущий объект
+  raw_hash_table &operator=(raw_hash_table &&other) noexcept {
+    if (this != &other) {
+      destroy_table();
+      swap(other);
+    }
+    return *this;
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return capacity_to_growth(slot_traits::max_size(alloc_) / 2);
+  }
+
+  /// @brief Число слотов таблицы
+  size_type bucket_count() const { return capacity_; }
+
+  /// @brief Доля занятых слотов
+  float load_factor() const {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+
+  /// @brief Удаляет все элементы, память таблицы сохраняется
+  void clear() {
+    if (capacity_ == 0) return;
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (ctrl_[i] >= 0) slot_traits::destroy(alloc_, slots_ + i);
+    }
+    std::memset(ctrl_, static_cast<uint8_t>(kEmpty), capacity_);
+    size_ = 0;
+    growth_left_ = capacity_to_growth(capacity_);
+  }
+
+  /// @brief Выделяет память так, чтобы вставки до count элементов не
+  /// перехешировали таблицу
+  /// @param count число элементов
+  void reserve(size_type count) {
+    if (count > max_size()) throw std::length_error("hash table too long");
+    if (count > size_ + growth_left_) rehash(growth_to_capacity(count));
+  }
+
+  /// @brief Удаляет элемент по ключу
+  /// @param key ключ
+  /// @return количество удалённых элементов: 0 или 1
+  size_type erase(const key_type &key) {
+    size_type index = find_index(key);
+    if (index == capacity_) return 0;
+    erase_index(index);
+    return 1;
+  }
+
+  /// @brief Проверяет, есть ли элемент с ключом
+  /// @param key ключ
+  /// @return true, если элемент есть
+  bool contains(const key_type &key) const {
+    return find_index(key) != capacity_;
+  }
+  template <typename K, typename = transparent_key_t<K>>
+  bool contains(const K &key) const {
+    return find_index(key) != capacity_;
+  }
+
+  void swap(raw_hash_table &other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+    std::swap(hash_, other.hash_);
+    std::swap(eq_, other.eq_);
+    std::swap(alloc_, other.alloc_);
+  }
+
+  /// @brief Переносит из other элементы с ключами, которых нет в текущей
+  /// таблице. Остальные элементы остаются в other
+  /// @param other таблица для объединения
+  void merge(raw_hash_table &other) {
+    if (this == &other) return;
+    for (size_type i = 0; i < other.capacity_; ++i) {
+      if (other.ctrl_[i] < 0) continue;
+      if (Policy::transfer(*this, other.slots_[i])) other.erase_index(i);
+    }
+  }
+
+  /// @brief Ищет слот с ключом. Группы перебираются треугольными шагами,
+  /// которые при числе групп - степени двойки обходят все группы. Поиск
+  /// заканчивается на группе с пустым слотом: дальше ключ попасть не мог
+  /// @return номер слота или bucket_count(), если ключа нет
+  template <typename K>
+  size_type find_index(const K &key) const {
+    if (size_ == 0) return capacity_;
+    const size_type hash = hash_of(key);
+    const size_type mask = capacity_ / kGroupWidth - 1;
+    size_type group = h1(hash) & mask;
+    for (size_type step = 1;; ++step) {
+      const size_type base = group * kGroupWidth;
+      Group g(ctrl_ + base);
+      for (Group::mask_t match = g.Match(h2(hash)); match; match &= match - 1) {
+        size_type index = base + Group::LowestIndex(match);
+        if (eq_(Policy::key(slots_[index]), key)) return index;
+      }
+      if (g.MatchEmpty()) return capacity_;
+      group = (group + step) & mask;
+    }
+  }
+
+  /// @brief Ищет слот с ключом
+  /// @return номер слота
+  /// @throw std::out_of_range, если ключа нет
+  template <typename K>
+  size_type checked_find(const K &key) const {
+    size_type index = find_index(key);
+    if (index == capacity_) throw std::out_of_range("Key not found");
+    return index;
+  }
+
+  /// @brief Находит элемент с ключом или создаёт его из key и args. Перед
+  /// ростом таблицы элемент собирается во временном объекте: args могут
+  /// ссылаться на элементы самой таблицы
+  /// @return номер слота и признак вставки
+  template <typename K, typename... Args>
+  std::pair<size_type, bool> emplace_key(K &&key, Args &&...args) {
+    size_type index = find_index(key);
+    if (index != capacity_) return {index, false};
+    const size_type hash = hash_of(key);
+    if (capacity_ > 0) index = find_first_non_full(hash);
+    if (capacity_ == 0 || (growth_left_ == 0 && ctrl_[index] != kDeleted)) {
+      value_type value =
+          Policy::make(std::forward<K>(key), std::forward<Args>(args)...);
+      if (size_ < capacity_to_growth(capacity_) / 2) {
+        rehash(capacity_);  // хватит места, освобождённого удалёнными слотами
+      } else {
+        rehash(growth_to_capacity(size_ + 1));
+      }
+      index = find_first_non_full(hash);
+      slot_traits::construct(alloc_, slots_ + index, std::move(value));
+    } else {
+      Policy::construct(alloc_, slots_ + index, std::forward<K>(key),
+                        std::forward<Args>(args)...);
+    }
+    growth_left_ -= ctrl_[index] == kEmpty;
+    ctrl_[index] = h2(hash);
+    ++size_;
+    return {index, true};
+  }
+
+  /// @brief Удаляет элемент. Если в группе слота есть пустой слот, поиск
+  /// остановился бы на ней и без этого слота, и он становится пустым, иначе
+  /// помечается удалённым
+  void erase_index(size_type index) {
+    slot_traits::destroy(alloc_, slots_ + index);
+    --size_;
+    if (Group(ctrl_ + index / kGroupWidth * kGroupWidth).MatchEmpty()) {
+      ctrl_[index] = kEmpty;
+      ++growth_left_;
+    } else {
+      ctrl_[index] = kDeleted;
+    }
+  }
+
+  value_type &slot(size_type index) { return slots_[index]; }
+  const value_type &slot(size_type index) const { return slots_[index]; }
+
+  /// @brief Итератор на слот index, bucket_count() даёт конец таблицы
+  template <typename Value>
+  hash_iterator<Value> iterator_at(size_type index) const {
+    return hash_iterator<Value>(ctrl_ + index, slots_ + index);
+  }
+
+  /// @brief Итератор на первый занятый слот
+  template <typename Value>
+  hash_iterator<Value> first() const {
+    if (size_ == 0) return iterator_at<Value>(capacity_);
+    hash_iterator<Value> it = iterator_at<Value>(0);
+    it.skip_empty();
+    return it;
+  }
+
+  /// @brief Номер слота, на который указывает итератор
+  template <typename Value>
+  size_type index_of(const hash_iterator<Value> &it) const {
+    return it.ctrl_ - ctrl_;
+  }
+
+ private:
+  ctrl_t *ctrl_ = nullptr;
+  value_type *slots_ = nullptr;
+  size_type capacity_ = 0;
+  size_type size_ = 0;
+  size_type growth_left_ = 0;
+  hasher hash_;
+  key_equal eq_;
+  slot_allocator alloc_;
+
+  template <typename K>
+  size_type hash_of(const K &key) const {
+    return hash_mix(hash_(key));
+  }
+  static size_type h1(size_type hash) { return hash >> 7; }
+  static ctrl_t h2(size_type hash) { return static_cast<ctrl_t>(hash & 0x7F); }
+
+  /// @brief Заполнение не выше 7/8: в таблице всегда есть пустые слоты, и
+  /// поиск отсутствующего ключа завершается
+  static size_type capacity_to_growth(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+  static size_type growth_to_capacity(size_type growth) {
+    size_type capacity = kGroupWidth;
+    while (capacity_to_growth(capacity) < growth) capacity *= 2;
+    return capacity;
+  }
+
+  /// @brief Первый пустой или удалённый слот на пути поиска хеша
+  size_type find_first_non_full(size_type hash) const {
+    const size_type mask = capacity_ / kGroupWidth - 1;
+    size_type group = h1(hash) & mask;
+    for (size_type step = 1;; ++step) {
+      const size_type base = group * kGroupWidth;
+      Group::mask_t match = Group(ctrl_ + base).MatchEmptyOrDeleted();
+      if (match) return base + Group::LowestIndex(match);
+      group = (group + step) & mask;
+    }
+  }
+
+  /// @brief Выделяет пустую таблицу из capacity слотов
+  void allocate_table(size_type capacity) {
+    ctrl_allocator ctrl_alloc(alloc_);
+    ctrl_t *ctrl = ctrl_traits::allocate(ctrl_alloc, capacity + 1);
+    try {
+      slots_ = slot_traits::allocate(alloc_, capacity);
+    } catch (...) {
+      ctrl_traits::deallocate(ctrl_alloc, ctrl, capacity + 1);
+      throw;
+    }
+    std::memset(ctrl, static_cast<uint8_t>(kEmpty), capacity);
+    ctrl[capacity] = kSentinel;
+    ctrl_ = ctrl;
+    capacity_ = capacity;
+    size_ = 0;
+    growth_left_ = capacity_to_growth(capacity);
+  }
+
+  /// @brief Разрушает элементы и освобождает память таблицы
+  void destroy_table() noexcept {
+    if (ctrl_) {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] >= 0) slot_traits::destroy(alloc_, slots_ + i);
+      }
+      ctrl_allocator ctrl_alloc(alloc_);
+      ctrl_traits::deallocate(ctrl_alloc, ctrl_, capacity_ + 1);
+      slot_traits::deallocate(alloc_, slots_, capacity_);
+    }
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+  }
+
+  /// @brief Переносит элементы в таблицу из capacity слотов, заодно очищая
+  /// удалённые слоты. Если копирование элемента бросает исключение, таблица
+  /// остаётся прежней
+  void rehash(size_type capacity) {
+    ctrl_t *old_ctrl = ctrl_;
+    value_type *old_slots = slots_;
+    const size_type old_capacity = capacity_;
+    const size_type old_size = size_;
+    const size_type old_growth_left = growth_left_;
+    try {
+      allocate_table(capacity);
+      for (size_type i = 0; i < old_capacity; ++i) {
+        if (old_ctrl[i] < 0) continue;
+        const size_type hash = hash_of(Policy::key(old_slots[i]));
+        const size_type index = find_first_non_full(hash);
+        slot_traits::construct(alloc_, slots_ + index,
+                               std::move_if_noexcept(old_slots[i]));
+        ctrl_[index] = h2(hash);
+        ++size_;
+      }
+    } catch (...) {
+      if (ctrl_ != old_ctrl) destroy_table();
+      ctrl_ = old_ctrl;
+      slots_ = old_slots;
+      capacity_ = old_capacity;
+      size_ = old_size;
+      growth_left_ = old_growth_left;
+      throw;
+    }
+    growth_left_ -= size_;
+    if (old_ctrl) {
+      for (size_type i = 0; i < old_capacity; ++i) {
+        if (old_ctrl[i] >= 0) slot_traits::destroy(alloc_, old_slots + i);
+      }
+      ctrl_allocator ctrl_alloc(alloc_);
+      ctrl_traits::deallocate(ctrl_alloc, old_ctrl, old_capacity + 1);
+      slot_traits::deallocate(alloc_, old_slots, old_capacity);
+    }
+  }
+};
+
+}  // namespace rpc
+
+#endif  // RPC_RAW_HASH_TABLE_H_
@@ -0,0 +1,342 @@
+#ifndef RPC_INTRUSIVE_LIST_H
+#define RPC_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+
+#include "../rpc_list/rpc_list.h"
+
+namespace rpc {
+
+/// @brief Интрузивный двусвязный список: объекты связываются через свое поле
+/// list_hook, поэтому список не выделяет память, не копирует и не владеет
+/// объектами - за время их жизни отвечает вызывающий. Через одно поле объект
+/// входит не более чем в один список. Алгоритмы (sort, merge, splice,
+/// reverse, unique) те же, что у rpc::list, - из list_ring. Вынутый из списка
+/// объект снова несвязан: hook.is_linked() == false
+/// @tparam T тип объектов
+/// @tparam Hook поле T типа list_hook, через которое связываются объекты
+template <typename T, list_hook T::*Hook>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+ protected:
+  list_hook sentinel_;
+  size_t size_;
+
+  class IntrusiveIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    IntrusiveIterator() : ptr_(nullptr) {}
+    reference operator*() const { return *owner(ptr_); }
+    pointer operator->() const { return owner(ptr_); }
+
+    IntrusiveIterator operator++(int) {
+      IntrusiveIterator it(*this);
+      ptr_ = ptr_->next_;
+      return it;
+    }
+    IntrusiveIterator operator--(int) {
+      IntrusiveIterator it(*this);
+      ptr_ = ptr_->prev_;
+      return it;
+    }
+    IntrusiveIterator& operator++() {
+      ptr_ = ptr_->next_;
+      return *this;
+    }
+    IntrusiveIterator& operator--() {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+    friend bool operator==(const IntrusiveIterator& a,
+                           const IntrusiveIterator& b) {
+      return a.ptr_ == b.ptr_;
+    }
+    friend bool operator!=(const IntrusiveIterator& a,
+                           const IntrusiveIterator& b) {
+      return a.ptr_ != b.ptr_;
+    }
+
+   private:
+    list_hook* ptr_;
+    friend class intrusive_list;
+
+    explicit IntrusiveIterator(list_hook* node) : ptr_(node) {}
+  };
+
+  class IntrusiveConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    IntrusiveConstIterator() : ptr_(nullptr) {}
+    IntrusiveConstIterator(const IntrusiveIterator& other)
+        : ptr_(other.ptr_) {}
+    reference operator*() const { return *owner(ptr_); }
+    pointer operator->() const { return owner(ptr_); }
+
+    IntrusiveConstIterator operator++(int) {
+      IntrusiveConstIterator it(*this);
+      ptr_ = ptr_->next_;
+      return it;
+    }
+    IntrusiveConstIterator operator--(int) {
+      IntrusiveConstIterator it(*this);
+      ptr_ = ptr_->prev_;
+      return it;
+    }
+    IntrusiveConstIterator& operator++() {
+      ptr_ = ptr_->next_;
+      return *this;
+    }
+    IntrusiveConstIterator& operator--() {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+    friend bool operator==(const IntrusiveConstIterator& a,
+                           const IntrusiveConstIterator& b) {
+      return a.ptr_ == b.ptr_;
+    }
+    friend bool operator!=(const IntrusiveConstIterator& a,
+                           const IntrusiveConstIterator& b) {
+      return a.ptr_ != b.ptr_;
+    }
+
+   private:
+    list_hook* ptr_;
+    friend class intrusive_list;
+
+    explicit IntrusiveConstIterator(list_hook* node) : ptr_(node) {}
+  };
+
+  // Смещение поля Hook от начала T. Указатель на член не дает смещение
+  // напрямую, поэтому оно берется на статическом буфере под T, в котором
+  // объект не создается: адреса буфера и поля - константы времени сборки, и
+  // компилятор сворачивает разность в число без обращения к памяти
+  static std::ptrdiff_t hook_offset() noexcept {
+    alignas(T) static unsigned char storage[sizeof(T)];
+    T* probe = reinterpret_cast<T*>(storage);
+    return reinterpret_cast<char*>(&(probe->*Hook)) -
+           reinterpret_cast<char*>(probe);
+  }
+
+  // Объект, которому принадлежит звено
+  static T* owner(list_hook* node) {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(node) - hook_offset());
+  }
+
+  static list_hook* hook_of(reference value) { return &(value.*Hook); }
+
+  list_hook* sentinel() const { return const_cast<list_hook*>(&sentinel_); }
+
+  void reset() {
+    list_ring::reset(&sentinel_);
+    size_ = 0;
+  }
+
+  // Сравнение звеньев по объектам для алгоритмов list_ring
+  template <typename Compare>
+  static auto by_value(Compare& comp) {
+    return [&comp](list_hook* a, list_hook* b) {
+      return comp(*owner(a), *owner(b));
+    };
+  }
+
+ public:
+  using iterator = IntrusiveIterator;
+  using const_iterator = IntrusiveConstIterator;
+
+  intrusive_list() : size_(0) {}
+  // объект может входить только в один список через Hook, копировать нечего
+  intrusive_list(const intrusive_list&) = delete;
+  intrusive_list& operator=(const intrusive_list&) = delete;
+
+  intrusive_list(intrusive_list&& other) : size_(0) { splice(cend(), other); }
+
+  intrusive_list& operator=(intrusive_list&& other) {
+    if (this != &other) {
+      clear();
+      splice(cend(), other);
+    }
+    return *this;
+  }
+
+  // объекты остаются живыми, но выходят из списка
+  ~intrusive_list() { clear(); }
+
+  reference front() { return *owner(sentinel_.next_); }
+  const_reference front() const { return *owner(sentinel_.next_); }
+  reference back() { return *owner(sentinel_.prev_); }
+  const_reference back() const { return *owner(sentinel_.prev_); }
+
+  iterator begin() { return iterator(sentinel_.next_); }
+  iterator end() { return iterator(&sentinel_); }
+  const_iterator begin() const { return const_iterator(sentinel_.next_); }
+  const_iterator end() const { return const_iterator(sentinel()); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  /// @brief Итератор на объект, который уже входит в список, за O(1)
+  static iterator iterator_to(reference value) {
+    return iterator(hook_of(value));
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+  /// @brief Выводит из списка все объекты, O(n): их звенья сбрасываются
+  void clear() {
+    list_hook* node = sentinel_.next_;
+    while (node != &sentinel_) {
+      list_hook* next = node->next_;
+      list_ring::reset(node);
+      node = next;
+    }
+    reset();
+  }
+
+  iterator insert(const_iterator pos, reference value) {
+    if (pos.ptr_ == nullptr) throw std::logic_error("Passed an empty iterator");
+    list_hook* node = hook_of(value);
+    if (node->is_linked()) throw std::logic_error("Object is already linked");
+    list_ring::link_before(pos.ptr_, node, node);
+    ++size_;
+    return iterator(node);
+  }
+
+  /// @brief Выводит объект по итератору из списка
+  /// @return итератор на следующий объект
+  iterator erase(const_iterator pos) {
+    list_hook* node = pos.ptr_;
+    if (node == nullptr || node == &sentinel_)
+      throw std::logic_error("Passed an empty iterator");
+    if (!node->is_linked()) throw std::logic_error("Object is not linked");
+    list_hook* next = node->next_;
+    list_ring::unlink(node, node);
+    list_ring::reset(node);
+    --size_;
+    return iterator(next);
+  }
+
+  /// @brief Выводит объект из списка за O(1), не ища его
+  void erase(reference value) { erase(iterator_to(value)); }
+
+  void push_back(reference value) { insert(cend(), value); }
+
+  void pop_back() {
+    if (size_ > 0) erase(const_iterator(sentinel_.prev_));
+  }
+
+  void push_front(reference value) { insert(cbegin(), value); }
+
+  void pop_front() {
+    if (size_ > 0) erase(cbegin());
+  }
+
+  void swap(intrusive_list& other) {
+    if (this == &other) return;
+    intrusive_list tmp(std::move(other));
+    other.splice(other.cend(), *this);
+    splice(cend(), tmp);
+  }
+
+  void merge(intrusive_list& other) { merge(other, std::less<value_type>()); }
+  void merge(intrusive_list&& other) { merge(other); }
+
+  template <typename Compare>
+  void merge(intrusive_list& other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    auto less = by_value(comp);
+    list_ring::merge(&sentinel_, &other.sentinel_, less);
+    size_ += other.size_;
+    other.reset();
+  }
+
+  template <typename Compare>
+  void merge(intrusive_list&& other, Compare comp) {
+    merge(other, comp);
+  }
+
+  void splice(const_iterator pos, intrusive_list& other) {
+    if (this == &other || other.empty()) return;
+    list_ring::link_before(pos.ptr_, other.sentinel_.next_,
+                           other.sentinel_.prev_);
+    size_ += other.size_;
+    other.reset();
+  }
+
+  void splice(const_iterator pos, intrusive_list&& other) {
+    splice(pos, other);
+  }
+
+  void splice(const_iterator pos, intrusive_list& other, const_iterator it) {
+    list_hook* node = it.ptr_;
+    if (node == nullptr || node == &other.sentinel_)
+      throw std::logic_error("Passed an empty iterator");
+    list_hook* at = pos.ptr_;
+    if (this == &other && (at == node || at == node->next_)) return;
+    list_ring::unlink(node, node);
+    --other.size_;
+    list_ring::link_before(at, node, node);
+    ++size_;
+  }
+
+  void splice(const_iterator pos, intrusive_list&& other, const_iterator it) {
+    splice(pos, other, it);
+  }
+
+  void splice(const_iterator pos, intrusive_list& other, const_iterator first,
+              const_iterator last) {
+    list_hook* from = first.ptr_;
+    list_hook* to = last.ptr_;
+    if (from == to) return;
+    list_hook* back = to->prev_;
+    size_type count = this == &other ? 0 : list_ring::count(from, to);
+    list_ring::unlink(from, back);
+    other.size_ -= count;
+    list_ring::link_before(pos.ptr_, from, back);
+    size_ += count;
+  }
+
+  void splice(const_iterator pos, intrusive_list&& other, const_iterator first,
+              const_iterator last) {
+    splice(pos, other, first, last);
+  }
+
+  void reverse() { list_ring::reverse(&sentinel_); }
+
+  /// @brief Выводит из списка повторы подряд идущих равных объектов
+  void unique() {
+    std::equal_to<value_type> eq;
+    auto equal = by_value(eq);
+    auto dispose = [](list_hook* node) { list_ring::reset(node); };
+    size_ -= list_ring::unique(&sentinel_, equal, dispose);
+  }
+
+  void sort() { sort(std::less<value_type>()); }
+
+  template <typename Compare>
+  void sort(Compare comp) {
+    auto less = by_value(comp);
+    list_ring::sort(&sentinel_, less);
+  }
+};
+
+}  // namespace rpc
+
+#endif  // RPC_INTRUSIVE_LIST_H
@@ -1,159 +1,331 @@
 #ifndef RPC_LIST_H
 #define RPC_LIST_H
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../rpc_allocator/rpc_allocator.h"
 
 namespace rpc {
 
-template <typename T>
+/// @brief Звено кольцевого двусвязного списка. Узлы rpc::list наследуют его,
+/// объекты в rpc::intrusive_list хранят его полем. Несвязанное звено замкнуто
+/// само на себя. Копия звена всегда несвязанная: копия объекта не попадает в
+/// чужой список
+struct list_hook {
+  list_hook* next_;
+  list_hook* prev_;
+
+  list_hook() noexcept : next_(this), prev_(this) {}
+  list_hook(const list_hook&) noexcept : list_hook() {}
+  list_hook& operator=(const list_hook&) noexcept { return *this; }
+
+  /// @brief Входит ли звено в какой-либо список
+  bool is_linked() const noexcept { return next_ != this; }
+};
+
+/// @brief Алгоритмы над кольцом из list_hook со сторожевым звеном, общие для
+/// rpc::list и rpc::intrusive_list. Меняют только указатели звеньев: значения
+/// не копируются, память не выделяется. Сравнения получают два звена, размеры
+/// списков ведут вызывающие
+struct list_ring {
+  /// @brief Делает кольцо sentinel пустым, звенья не трогает
+  static void reset(list_hook* sentinel) noexcept {
+    sentinel->next_ = sentinel->prev_ = sentinel;
+  }
+
+  /// @brief Вырезает цепочку first..last (включительно) из ее кольца
+  static void unlink(list_hook* first, list_hook* last) noexcept {
+    first->prev_->next_ = last->next_;
+    last->next_->prev_ = first->prev_;
+  }
+
+  /// @brief Вставляет цепочку first..last перед звеном at
+  static void link_before(list_hook* at, list_hook* first,
+                          list_hook* last) noexcept {
+    list_hook* prev = at->prev_;
+    first->prev_ = prev;
+    last->next_ = at;
+    prev->next_ = first;
+    at->prev_ = last;
+  }
+
+  /// @brief Число звеньев в [first, last)
+  static size_t count(list_hook* first, list_hook* last) noexcept {
+    size_t n = 0;
+    for (; first != last; first = first->next_) ++n;
+    return n;
+  }
+
+  /// @brief Замыкает на sentinel цепочку head, связанную только по next_ и
+  /// заканчивающуюся nullptr: заново проставляет prev_
+  static void relink(list_hook* sentinel, list_hook* head) noexcept {
+    list_hook* prev = sentinel;
+    for (list_hook* node = head; node; node = node->next_) {
+      prev->next_ = node;
+      node->prev_ = prev;
+      prev = node;
+    }
+    prev->next_ = sentinel;
+    sentinel->prev_ = prev;
+  }
+
+  /// @brief Меняет местами next_ и prev_ у каждого звена, включая
+  /// сторожевое
+  static void reverse(list_hook* sentinel) noexcept {
+    list_hook* node = sentinel;
+    do {
+      std::swap(node->next_, node->prev_);
+      node = node->prev_;
+    } while (node != sentinel);
+  }
+
+  /// @brief Вплетает непустое отсортированное кольцо other в отсортированное
+  /// кольцо sentinel за один проход: next_ и prev_ проставляются сразу.
+  /// Устойчиво: из равных первыми идут звенья sentinel. Кольцо other
+  /// остается испорченным, его нужно сбросить через reset
+  template <typename Less>
+  static void merge(list_hook* sentinel, list_hook* other, Less& less) {
+    list_hook* left = sentinel->next_;
+    list_hook* right = other->next_;
+    list_hook* prev = sentinel;
+    while (left != sentinel && right != other) {
+      list_hook*& pick = less(right, left) ? right : left;
+      list_hook* node = pick;
+      pick = node->next_;
+      node->prev_ = prev;
+      prev->next_ = node;
+      prev = node;
+    }
+    if (left != sentinel) {
+      prev->next_ = left;
+      left->prev_ = prev;
+    } else {
+      prev->next_ = right;
+      right->prev_ = prev;
+      sentinel->prev_ = other->prev_;
+      sentinel->prev_->next_ = sentinel;
+    }
+  }
+
+  /// @brief Устойчивая сортировка кольца слиянием
+  template <typename Less>
+  static void sort(list_hook* sentinel, Less& less) {
+    if (sentinel->next_ == sentinel->prev_) return;
+    sentinel->prev_->next_ = nullptr;
+    relink(sentinel, MergeSort(sentinel->next_, less));
+  }
+
+  /// @brief Вырезает из каждой группы подряд идущих равных звеньев все, кроме
+  /// первого, и передает их в dispose
+  /// @return число вырезанных звеньев
+  template <typename Equal, typename Dispose>
+  static size_t unique(list_hook* sentinel, Equal& equal, Dispose& dispose) {
+    size_t removed = 0;
+    list_hook* node = sentinel->next_;
+    while (node != sentinel && node->next_ != sentinel) {
+      list_hook* next = node->next_;
+      if (equal(node, next)) {
+        list_ring::unlink(next, next);
+        dispose(next);
+        ++removed;
+      } else {
+        node = next;
+      }
+    }
+    return removed;
+  }
+
+ private:
+  // Stable merge of two sorted null-terminated chains linked by next_.
+  // On equal elements the left chain goes first.
+  template <typename Less>
+  static list_hook* Merge(list_hook* left, list_hook* right, Less& less) {
+    list_hook* res = nullptr;
+    list_hook** tail = &res;
+    while (left && right) {
+      if (less(right, left)) {
+        *tail = right;
+        right = right->next_;
+      } else {
+        *tail = left;
+        left = left->next_;
+      }
+      tail = &(*tail)->next_;
+    }
+    *tail = left ? left : right;
+    return res;
+  }
+
+  // Bottom-up merge sort: bucket i holds a sorted run of 2^i nodes, runs are
+  // carried up like a binary counter. Stack usage does not depend on size.
+  template <typename Less>
+  static list_hook* MergeSort(list_hook* node, Less& less) {
+    const size_t kBuckets = std::numeric_limits<size_t>::digits;
+    list_hook* buckets[kBuckets] = {};
+    size_t fill = 0;
+    while (node) {
+      list_hook* carry = node;
+      node = node->next_;
+      carry->next_ = nullptr;
+      size_t i = 0;
+      for (; i < fill && buckets[i]; ++i) {
+        carry = Merge(buckets[i], carry, less);
+        buckets[i] = nullptr;
+      }
+      buckets[i] = carry;
+      if (i == fill) ++fill;
+    }
+    list_hook* res = nullptr;
+    for (size_t i = 0; i < fill; ++i)
+      if (buckets[i]) res = res ? Merge(buckets[i], res, less) : buckets[i];
+    return res;
+  }
+};
+
+// Кольцевой двусвязный список со сторожевым узлом: sentinel_ хранится в
+// самом объекте списка, sentinel_.next_ - первый элемент, sentinel_.prev_ -
+// последний, end() указывает на sentinel_. У всех узлов next_ и prev_ не
+// нулевые, поэтому итератор - один указатель, а ++/-- без ветвлений.
+template <typename T, typename Allocator = pool_allocator<T>>
 class list {
  public:
   using value_type = T;
   using reference = T&;
   using const_reference = const T&;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
  protected:
-  struct Node {
+  struct Node : list_hook {
     value_type value_;
-    Node* next_;
-    Node* prev_;
-    Node(value_type value) : value_(value), next_(nullptr), prev_(nullptr) {}
+    Node(value_type value) : value_(value) {}
   };
-  // Node (value_type &value_) : value_(value) {};
-  Node* head_;
-  Node* end_;
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+  list_hook sentinel_;
   size_t size_;
+  node_allocator alloc_;
 
   class ListIterator {
    public:
-    ListIterator() : ptr_(nullptr), _end(false) {}
-    reference operator*() { return this->ptr_->value_; }
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    ListIterator() : ptr_(nullptr) {}
+    reference operator*() const { return static_cast<Node*>(ptr_)->value_; }
+    pointer operator->() const { return &static_cast<Node*>(ptr_)->value_; }
 
     ListIterator operator++(int) {
       ListIterator it(*this);
-      if (ptr_->next_)
-        ptr_ = ptr_->next_;
-      else
-        _end = true;
+      ptr_ = ptr_->next_;
       return it;
     }
     ListIterator operator--(int) {
       ListIterator it(*this);
-      if (_end) {
-        _end = false;
-      } else if (ptr_->prev_)
-        ptr_ = ptr_->prev_;
+      ptr_ = ptr_->prev_;
       return it;
     }
-
-    ListIterator operator++() {
-      if (ptr_->next_)
-        ptr_ = ptr_->next_;
-      else
-        _end = true;
+    ListIterator& operator++() {
+      ptr_ = ptr_->next_;
       return *this;
     }
-    ListIterator operator--() {
-      if (_end) {
-        _end = false;
-      } else if (ptr_->prev_)
-        ptr_ = ptr_->prev_;
+    ListIterator& operator--() {
+      ptr_ = ptr_->prev_;
       return *this;
     }
-    bool operator==(const ListIterator& it) {
-      if (this->_end != it._end)
-        return false;
-      else if (it._end)
-        return true;
-      else
-        return this->ptr_ == it.ptr_;
+    friend bool operator==(const ListIterator& a, const ListIterator& b) {
+      return a.ptr_ == b.ptr_;
     }
-    bool operator!=(const ListIterator& it) {
-      if (this->_end != it._end)
-        return true;
-      else if (it._end)
-        return false;
-      else
-        return this->ptr_ != it.ptr_;
+    friend bool operator!=(const ListIterator& a, const ListIterator& b) {
+      return a.ptr_ != b.ptr_;
     }
 
-    ~ListIterator() = default;
-
    private:
-    Node* ptr_;
-    bool _end;
+    list_hook* ptr_;
     friend class list;
 
-    ListIterator(Node* node, bool end) : ptr_(node), _end(end) {}
+    explicit ListIterator(list_hook* node) : ptr_(node) {}
   };
 
-  class ListConstIterator : public ListIterator {
+  // Константный итератор: тот же указатель на узел, но operator* отдает
+  // const_reference. Неявно строится из ListIterator
+  class ListConstIterator {
    public:
-    ListConstIterator() : ListIterator() {}
-    ListConstIterator(const ListIterator& other) : ListIterator(other) {}
-    const_reference operator*() const { return ListIterator::operator*(); }
-    ListConstIterator operator++() {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    ListConstIterator() : ptr_(nullptr) {}
+    ListConstIterator(const ListIterator& other) : ptr_(other.ptr_) {}
+    reference operator*() const { return static_cast<Node*>(ptr_)->value_; }
+    pointer operator->() const { return &static_cast<Node*>(ptr_)->value_; }
+
+    ListConstIterator operator++(int) {
+      ListConstIterator it(*this);
       ptr_ = ptr_->next_;
-      return ptr_;
+      return it;
     }
-    ListConstIterator operator--() {
+    ListConstIterator operator--(int) {
+      ListConstIterator it(*this);
       ptr_ = ptr_->prev_;
-      return ptr_;
+      return it;
     }
-    bool operator==(const ListConstIterator& it) {
-      return this->ptr_ == it->ptr_;
+    ListConstIterator& operator++() {
+      ptr_ = ptr_->next_;
+      return *this;
     }
-    bool operator!=(const ListConstIterator& it) {
-      return this->ptr_ != it->ptr_;
+    ListConstIterator& operator--() {
+      ptr_ = ptr_->prev_;
+      return *this;
+    }
+    friend bool operator==(const ListConstIterator& a,
+                           const ListConstIterator& b) {
+      return a.ptr_ == b.ptr_;
+    }
+    friend bool operator!=(const ListConstIterator& a,
+                           const ListConstIterator& b) {
+      return a.ptr_ != b.ptr_;
     }
-    ~ListConstIterator() = default;
 
    private:
-    Node* ptr_;
+    list_hook* ptr_;
     friend class list;
+
+    explicit ListConstIterator(list_hook* node) : ptr_(node) {}
   };
 
-  Node* get_middle(Node* node) {
-    Node* first = node;
-    Node* half = node;
-    while (first->next_ != nullptr && first->next_->next_ != nullptr) {
-      half = half->next_;
-      first = first->next_->next_;
-    }
-    return half;
-  }
-
-  Node* Merge(Node* left, Node* right) {
-    Node* res;
-    if (!left)
-      res = right;
-    else if (!right)
-      res = left;
-    else if (left->value_ <= right->value_) {
-      res = left;
-      res->next_ = Merge(left->next_, right);
-    } else {
-      res = right;
-      res->next_ = Merge(left, right->next_);
-    }
-    return res;
+  static reference value_of(list_hook* node) {
+    return static_cast<Node*>(node)->value_;
   }
 
-  Node* MergeSort(Node* node) {
-    Node* res;
-    if (!node || !node->next_) {
-      res = node;
-    } else {
-      Node* mid = get_middle(node);
-      Node* mid_next = mid->next_;
-      mid->next_ = nullptr;
-      Node* left = MergeSort(node);
-      Node* right = MergeSort(mid_next);
-      res = Merge(left, right);
-    }
-    return res;
+  // Сторожевой узел без const: итераторы константного списка хранят тот же
+  // указатель, что и обычные
+  list_hook* sentinel() const { return const_cast<list_hook*>(&sentinel_); }
+
+  // Возвращает список в пустое состояние, узлы не освобождает
+  void reset() {
+    list_ring::reset(&sentinel_);
+    size_ = 0;
+  }
+
+  // Сравнение звеньев по значениям для алгоритмов list_ring
+  template <typename Compare>
+  static auto by_value(Compare& comp) {
+    return [&comp](list_hook* a, list_hook* b) {
+      return comp(value_of(a), value_of(b));
+    };
   }
 
  public:
@@ -161,52 +333,31 @@ class list {
   using const_iterator = ListConstIterator;
 
   // Constructors
-  list() : head_(nullptr), end_(nullptr), size_(0) {}
+  list() : size_(0) {}
 
-  list(size_type n) {
-    head_ = nullptr;
-    end_ = nullptr;
-    size_ = 0;
+  list(size_type n) : size_(0) {
     for (size_t i = 0; i < n; ++i) push_back(0);
   }
 
-  list(std::initializer_list<value_type> const& items) {
-    head_ = nullptr;
-    end_ = nullptr;
-    size_ = 0;
+  list(std::initializer_list<value_type> const& items) : size_(0) {
     for (auto& i : items) {
       push_back(i);
     }
   }
 
-  list(const list& l) {
-    head_ = nullptr;
-    end_ = nullptr;
-    size_ = 0;
-    Node* temp = l.head_;
-    while (temp) {
-      push_back(temp->value_);
-      temp = temp->next_;
-    }
+  list(const list& l) : size_(0) {
+    for (const_reference value : l) push_back(value);
   }
 
-  list(list&& other)
-      : head_(other.head_), end_(other.end_), size_(other.size_) {
-    other.head_ = nullptr;
-    other.end_ = nullptr;
-    other.size_ = 0;
-  }
+  // узлы перевешиваются на sentinel_ нового объекта
+  list(list&& other) : size_(0) { splice(cend(), other); }
 
   ~list() { clear(); }
 
   list& operator=(const list& l) {
-    head_ = nullptr;
-    end_ = nullptr;
-    size_ = 0;
-    Node* temp = l.head_;
-    while (temp) {
-      push_back(temp->value_);
-      temp = temp->next_;
+    if (this != &l) {
+      clear();
+      for (const_reference value : l) push_back(value);
     }
     return *this;
   }
@@ -214,219 +365,175 @@ class list {
   list& operator=(list&& l) {
     if (this != &l) {
       clear();
-      head_ = l.head_;
-      end_ = l.end_;
-      size_ = l.size_;
-
-      l.head_ = nullptr;
-      l.end_ = nullptr;
-      l.size_ = 0;
+      splice(cend(), l);
     }
     return *this;
   }
 
   // публичные методы для доступа к элементам класса
-  const_reference front() { return head_->value_; }
-  const_reference back() { return end_->value_; }
+  const_reference front() const { return value_of(sentinel_.next_); }
+  const_reference back() const { return value_of(sentinel_.prev_); }
 
   // публичные методы для итерирования по элементам класса (доступ к итераторам)
-  iterator begin() {
-    return (size_ == 0) ? iterator(head_, true) : iterator(head_, false);
-  }
-
-  iterator end() { return iterator(end_, true); }
+  iterator begin() { return iterator(sentinel_.next_); }
+  iterator end() { return iterator(&sentinel_); }
+  const_iterator begin() const { return const_iterator(sentinel_.next_); }
+  const_iterator end() const { return const_iterator(sentinel()); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
 
   // публичные методы для доступа к информации о наполнении контейнера
-  bool empty() { return size_ == 0; }
-  size_type size() { return size_; }
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
   size_type max_size() {
     return (std::numeric_limits<size_type>::max() / sizeof(Node) / 2);
   }
 
   // публичные методы для изменения контейнера
   void clear() {
-    while (!empty()) pop_back();
-    head_ = nullptr;
-    end_ = nullptr;
-  }
-
-  iterator insert(iterator pos, const_reference value) {
-    if (pos == begin()) {
-      push_front(value);
-      pos = begin();
-    } else if (pos == end()) {
-      push_back(value);
-      pos = --end();
-    } else if (pos.ptr_ == nullptr) {
-      throw std::logic_error("Passed an empty iterator");
-    } else {
-      Node* temp = new Node(value);
-      Node* cur = pos.ptr_;
-      temp->next_ = cur;
-      temp->prev_ = cur->prev_;
-      cur->prev_->next_ = temp;
-      cur->prev_ = temp;
-      size_++;
-      pos = iterator(temp, false);
+    list_hook* node = sentinel_.next_;
+    while (node != &sentinel_) {
+      list_hook* next = node->next_;
+      destroy_node(alloc_, static_cast<Node*>(node));
+      node = next;
     }
-    return pos;
+    reset();
   }
 
-  void erase(iterator pos) {
-    if (pos == begin())
-      pop_front();
-    else if (pos == --end())
-      pop_back();
-    else if (pos.ptr_ == nullptr)
-      throw std::logic_error("Passed an empty iterator");
-    else {
-      pos.ptr_->prev_->next_ = pos.ptr_->next_;
-      pos.ptr_->next_->prev_ = pos.ptr_->prev_;
-      size_--;
-      delete pos.ptr_;
-    }
+  iterator insert(const_iterator pos, const_reference value) {
+    if (pos.ptr_ == nullptr) throw std::logic_error("Passed an empty iterator");
+    Node* node = create_node<Node>(alloc_, value);
+    list_ring::link_before(pos.ptr_, node, node);
+    ++size_;
+    return iterator(node);
   }
 
-  void push_back(const_reference value) {
-    Node* newNode = new Node(value);
-    if (!empty()) {
-      end_->next_ = newNode;
-      end_->next_->prev_ = end_;
-      end_ = end_->next_;
-      newNode = nullptr;
-    } else {
-      head_ = end_ = newNode;
-    }
-    ++size_;
+  void erase(const_iterator pos) {
+    if (pos.ptr_ == nullptr || pos.ptr_ == &sentinel_)
+      throw std::logic_error("Passed an empty iterator");
+    list_ring::unlink(pos.ptr_, pos.ptr_);
+    --size_;
+    destroy_node(alloc_, static_cast<Node*>(pos.ptr_));
   }
 
+  void push_back(const_reference value) { insert(cend(), value); }
+
   void pop_back() {
-    if (size_ > 0) {
-      if (end_ == head_) {
-        delete head_;
-        head_ = end_ = nullptr;
-      } else {
-        Node* newNode = end_;
-        end_ = end_->prev_;
-        end_->next_ = nullptr;
-        delete newNode;
-      }
-      --size_;
-    }
+    if (size_ > 0) erase(const_iterator(sentinel_.prev_));
   }
 
-  void push_front(const_reference value) {
-    Node* newNode = new Node(value);
-    if (!empty()) {
-      head_->prev_ = newNode;
-      newNode->next_ = head_;
-      head_ = newNode;
-    } else {
-      head_ = end_ = newNode;
-    }
-    ++size_;
-  }
+  void push_front(const_reference value) { insert(cbegin(), value); }
 
   void pop_front() {
-    if (size_ > 0) {
-      if (end_ == head_) {
-        delete head_;
-        head_ = end_ = nullptr;
-      } else {
-        Node* newNode = head_;
-        head_ = head_->next_;
-        head_->prev_ = nullptr;
-        delete newNode;
-      }
-      --size_;
-    }
+    if (size_ > 0) erase(cbegin());
   }
 
+  // Swap: цепочки узлов перевешиваются между сторожевыми узлами, O(1)
   void swap(list& other) {
-    Node newNode = this->head_;
-    int size = this->size_;
-    this->head_ = other->head_;
-    this->size_ = other->size_;
-    other->head_ = newNode->head_;
-    other->size_ = newNode->size_;
-  }
-
-  void merge(list& other) {
-    if (this != &other) {
-      auto it_other = other.begin(), it_this = begin();
-      while (other.size_ > 0) {
-        if (size_ == 0) {
-          push_front(*it_other);
-          other.erase(it_other);
-          if (other.size_ > 0) it_other = other.begin();
-        } else {
-          if (it_this == end() || *it_other < *it_this) {
-            insert(it_this, *it_other);
-            other.erase(it_other);
-            if (other.size_ > 0) it_other = other.begin();
-          } else {
-            it_this++;
-          }
-        }
-      }
-    }
+    if (this == &other) return;
+    list tmp(std::move(other));
+    other.splice(other.cend(), *this);
+    splice(cend(), tmp);
   }
 
+  // Merge: узлы other вплетаются в список перевешиванием указателей, без
+  // копирования значений и без обращения к аллокатору. Устойчиво: из равных
+  // элементов первыми идут элементы этого списка
+  void merge(list& other) { merge(other, std::less<value_type>()); }
+  void merge(list&& other) { merge(other); }
+
+  template <typename Compare>
+  void merge(list& other, Compare comp) {
+    if (this == &other || other.empty()) return;
+    auto less = by_value(comp);
+    list_ring::merge(&sentinel_, &other.sentinel_, less);
+    size_ += other.size_;
+    other.reset();
+  }
+
+  template <typename Compare>
+  void merge(list&& other, Compare comp) {
+    merge(other, comp);
+  }
+
+  // Splice: узлы other перевешиваются перед pos без копирования значений и
+  // без обращения к аллокатору, итераторы на перенесенные элементы остаются
+  // валидными. Весь список и диапазон внутри одного списка - O(1), диапазон
+  // из другого списка проходится один раз, чтобы пересчитать size_.
   void splice(const_iterator pos, list& other) {
-    if (other.size_ > 0)
-      for (auto it = other.begin(); it != other.end(); ++it) insert(pos, *it);
+    if (this == &other || other.empty()) return;
+    list_hook* first = other.sentinel_.next_;
+    list_hook* last = other.sentinel_.prev_;
+    list_ring::link_before(pos.ptr_, first, last);
+    size_ += other.size_;
+    other.reset();
   }
 
-  void reverse() {
-    auto it1 = begin(), it2 = --end();
-    if (size_ % 2 == 0) {
-      for (size_type i = 0; i < size_ / 2; ++i) {
-        std::swap(*it1, *it2);
-        ++it1;
-        --it2;
-      }
-    } else {
-      while (it1 != it2) {
-        std::swap(*it1, *it2);
-        ++it1;
-        --it2;
-      }
-    }
+  void splice(const_iterator pos, list&& other) { splice(pos, other); }
+
+  void splice(const_iterator pos, list& other, const_iterator it) {
+    list_hook* node = it.ptr_;
+    if (node == nullptr || node == &other.sentinel_)
+      throw std::logic_error("Passed an empty iterator");
+    list_hook* at = pos.ptr_;
+    if (this == &other && (at == node || at == node->next_)) return;
+    list_ring::unlink(node, node);
+    --other.size_;
+    list_ring::link_before(at, node, node);
+    ++size_;
+  }
+
+  void splice(const_iterator pos, list&& other, const_iterator it) {
+    splice(pos, other, it);
+  }
+
+  void splice(const_iterator pos, list& other, const_iterator first,
+              const_iterator last) {
+    list_hook* from = first.ptr_;
+    list_hook* to = last.ptr_;
+    if (from == to) return;
+    list_hook* back = to->prev_;
+    size_type count = this == &other ? 0 : list_ring::count(from, to);
+    list_ring::unlink(from, back);
+    other.size_ -= count;
+    list_ring::link_before(pos.ptr_, from, back);
+    size_ += count;
   }
 
+  void splice(const_iterator pos, list&& other, const_iterator first,
+              const_iterator last) {
+    splice(pos, other, first, last);
+  }
+
+  // Reverse: у каждого узла, включая сторожевой, меняются местами next_ и
+  // prev_, значения не трогаются
+  void reverse() { list_ring::reverse(&sentinel_); }
+
+  // Unique: повторы вырезаются из кольца и освобождаются, остальные узлы не
+  // трогаются
   void unique() {
-    if (size_ > 1) {
-      for (auto i = begin(); i != end();) {
-        auto next = i;
-        next++;
-        if (next != end()) {
-          if (*i == *next)
-            erase(next);
-          else
-            ++i;
-        } else
-          ++i;
-      }
-    }
+    std::equal_to<value_type> eq;
+    auto equal = by_value(eq);
+    auto dispose = [this](list_hook* node) {
+      destroy_node(alloc_, static_cast<Node*>(node));
+    };
+    size_ -= list_ring::unique(&sentinel_, equal, dispose);
   }
 
-  // Merge Sort
-  void sort() {
-    if (size_ > 1) {
-      head_ = MergeSort(head_);
-      end_ = head_;
-      while (end_->next_) {
-        end_->next_->prev_ = end_;
-        end_ = end_->next_;
-      }
-    }
+  // Merge Sort, stable
+  void sort() { sort(std::less<value_type>()); }
+
+  template <typename Compare>
+  void sort(Compare comp) {
+    auto less = by_value(comp);
+    list_ring::sort(&sentinel_, less);
   }
 
   //  Extras
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args&&... args) {
     list tmp{args...};
-    iterator cur_pos = pos;
+    iterator cur_pos(pos.ptr_);
     for (auto i : tmp) {
       cur_pos = insert(cur_pos, i);
       ++cur_pos;
@@ -450,4 +557,4 @@ class list {
 };
 }  // namespace rpc
 
-#endif
\ No newline at end of file
+#endif
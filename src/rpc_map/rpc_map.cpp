@@ -7,15 +7,16 @@ namespace rpc {
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @tparam Key тип ключа
  * @tparam T тип хранимых данных
  * @param other итератор для сравнения
  * @return true если итераторы равны
  * @return false если итераторы не равны
  */
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename Allocator>
 template <typename Key, typename T>
-bool map<key_type, mapped_type>::MapIterator<Key, T>::operator==(
+bool map<key_type, mapped_type, Allocator>::MapIterator<Key, T>::operator==(
     const MapIterator &other) const {
   return other.m_node == m_node;
 }
@@ -25,15 +26,16 @@ bool map<key_type, mapped_type>::MapIterator<Key, T>::operator==(
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @tparam Key тип ключа
  * @tparam T тип хранимых данных
  * @param other итератор для сравнения
  * @return true если итераторы не равны
  * @return false если итераторы равны
  */
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename Allocator>
 template <typename Key, typename T>
-bool map<key_type, mapped_type>::MapIterator<Key, T>::operator!=(
+bool map<key_type, mapped_type, Allocator>::MapIterator<Key, T>::operator!=(
     const MapIterator &other) const {
   return other.m_node != m_node;
 }
@@ -43,14 +45,15 @@ bool map<key_type, mapped_type>::MapIterator<Key, T>::operator!=(
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @tparam Key тип ключа
  * @tparam T тип хранимых данных
  * @return ссылка на элемент
  */
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename Allocator>
 template <typename Key, typename T>
-typename map<key_type, mapped_type>::template MapIterator<Key, T> &
-map<key_type, mapped_type>::MapIterator<Key, T>::operator++() {
+typename map<key_type, mapped_type, Allocator>::template MapIterator<Key, T> &
+map<key_type, mapped_type, Allocator>::MapIterator<Key, T>::operator++() {
   if (m_node->right) {
     m_node = m_node->right;
     while (m_node->left) {
@@ -74,14 +77,15 @@ map<key_type, mapped_type>::MapIterator<Key, T>::operator++() {
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @tparam Key тип ключа
  * @tparam T тип хранимых данных
  * @return ссылка на элемент
  */
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename Allocator>
 template <typename Key, typename T>
-typename map<key_type, mapped_type>::template MapIterator<Key, T> &
-map<key_type, mapped_type>::MapIterator<Key, T>::operator--() {
+typename map<key_type, mapped_type, Allocator>::template MapIterator<Key, T> &
+map<key_type, mapped_type, Allocator>::MapIterator<Key, T>::operator--() {
   if (m_node->left) {
     m_node = m_node->left;
     while (m_node->right) {
@@ -103,14 +107,16 @@ map<key_type, mapped_type>::MapIterator<Key, T>::operator--() {
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @tparam Key тип ключа
  * @tparam T тип хранимых данных
  * @return ссылка на элемент
  */
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename Allocator>
 template <typename Key, typename T>
-typename map<key_type, mapped_type>::template MapConstIterator<Key, T> &
-map<key_type, mapped_type>::MapConstIterator<Key, T>::operator++() {
+typename map<key_type, mapped_type, Allocator>::template MapConstIterator<Key,
+                                                               T> &
+map<key_type, mapped_type, Allocator>::MapConstIterator<Key, T>::operator++() {
   m_node = root_;
   if (m_node->right) {
     m_node = m_node->right;
@@ -133,14 +139,16 @@ map<key_type, mapped_type>::MapConstIterator<Key, T>::operator++() {
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @tparam Key тип ключа
  * @tparam T тип хранимых данных
  * @return ссылка на элемент
  */
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename Allocator>
 template <typename Key, typename T>
-typename map<key_type, mapped_type>::template MapConstIterator<Key, T> &
-map<key_type, mapped_type>::MapConstIterator<Key, T>::operator--() {
+typename map<key_type, mapped_type, Allocator>::template MapConstIterator<Key,
+                                                               T> &
+map<key_type, mapped_type, Allocator>::MapConstIterator<Key, T>::operator--() {
   m_node = root_;
   if (m_node->left) {
     m_node = m_node->left;
@@ -162,18 +170,20 @@ map<key_type, mapped_type>::MapConstIterator<Key, T>::operator--() {
  * @brief Базовый конструктор
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  */
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map() : root_(nullptr), size_(0){};
+template <typename key_type, typename mapped_type, typename Allocator>
+map<key_type, mapped_type, Allocator>::map() : root_(nullptr), size_(0){};
 
 /**
  * @brief Конструктор на базе списка инициализаций
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param items списка инициализаций
  */
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(
+template <typename key_type, typename mapped_type, typename Allocator>
+map<key_type, mapped_type, Allocator>::map(
     std::initializer_list<std::pair<const key_type, mapped_type>> const
         &items) {
   for (auto object : items) {
@@ -185,24 +195,25 @@ map<key_type, mapped_type>::map(
  * @brief Конструктор копирования
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param m контейнер map для копирования
  */
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(const map &m) {
-  if (m.root_ != nullptr) {
-    size_ = m.size_;
-    root_ = CopyTree(*m.root_);
-  }
+template <typename key_type, typename mapped_type, typename Allocator>
+map<key_type, mapped_type, Allocator>::map(const map &m) {
+  root_ = CopyTree(m.root_);
+  size_ = m.size_;
 }
 
 /**
  * @brief Конструктор переноса
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param m контейнер map для переноса
  */
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(map &&m) : root_(m.root_), size_(m.size_) {
+template <typename key_type, typename mapped_type, typename Allocator>
+map<key_type, mapped_type, Allocator>::map(map &&m)
+    : root_(m.root_), size_(m.size_) {
   m.root_ = nullptr;
 }
 
@@ -210,16 +221,20 @@ map<key_type, mapped_type>::map(map &&m) : root_(m.root_), size_(m.size_) {
  * @brief Оператор присвоения переносом
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param m контейнер map для переноса
  * @return ссылка на текущий объект
  */
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type> &map<key_type, mapped_type>::operator=(
-    map &&m) noexcept {
-  size_ = m.size_;
-  const Node *tmp = m.root_;
-  root_ = CopyTree(*tmp);
-
+template <typename key_type, typename mapped_type, typename Allocator>
+map<key_type, mapped_type, Allocator> &
+map<key_type, mapped_type, Allocator>::operator=(map &&m) noexcept {
+  if (this != &m) {
+    clear();
+    root_ = m.root_;
+    size_ = m.size_;
+    m.root_ = nullptr;
+    m.size_ = 0;
+  }
   return *this;
 }
 
@@ -227,9 +242,10 @@ map<key_type, mapped_type> &map<key_type, mapped_type>::operator=(
  * @brief Деструктор
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  */
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::~map() {
+template <typename key_type, typename mapped_type, typename Allocator>
+map<key_type, mapped_type, Allocator>::~map() {
   clear();
 }
 
@@ -237,19 +253,13 @@ map<key_type, mapped_type>::~map() {
  * @brief Доступ к указанному элементу с проверкой границ
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param key ключ
  * @return ссылка на хранимое значение
  */
-template <typename key_type, typename mapped_type>
-mapped_type &map<key_type, mapped_type>::at(const key_type &key) {
-  Node *tmp = root_;
-  while (tmp && tmp->key != key) {
-    if (tmp->key < key) {
-      tmp = tmp->right;
-    } else if (tmp->key > key) {
-      tmp = tmp->left;
-    }
-  }
+template <typename key_type, typename mapped_type, typename Allocator>
+mapped_type &map<key_type, mapped_type, Allocator>::at(const key_type &key) {
+  Node *tmp = findNode(key);
   if (tmp == nullptr) {
     throw std::out_of_range("Key not found");
   } else {
@@ -261,39 +271,14 @@ mapped_type &map<key_type, mapped_type>::at(const key_type &key) {
  * @brief Доступ или вставка указанного элемента
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param key ключ для поиска
  * @return ссылка на хранимое значение
  */
-template <typename key_type, typename mapped_type>
-mapped_type &map<key_type, mapped_type>::operator[](const key_type &key) {
-  Node *dest = root_;
-  while (dest && dest->key != key) {
-    if (dest->key < key) {
-      if (dest->right == nullptr) {
-        dest->right = new Node();
-        dest->right->key = key;
-        dest->right->parent = dest;
-        size_++;
-      }
-      dest = dest->right;
-    } else if (dest->key > key) {
-      if (dest->left == nullptr) {
-        dest->left = new Node();
-        dest->left->key = key;
-        dest->left->parent = dest;
-        size_++;
-      }
-      dest = dest->left;
-    }
-  }
-  if (!dest) {
-    dest = new Node();
-    dest->key = key;
-    root_ = dest;
-    size_++;
-  }
-
-  return dest->data;
+template <typename key_type, typename mapped_type, typename Allocator>
+mapped_type &map<key_type, mapped_type, Allocator>::operator[](
+    const key_type &key) {
+  return insertNode(key, mapped_type()).first->data;
 }
 
 /**
@@ -301,11 +286,12 @@ mapped_type &map<key_type, mapped_type>::operator[](const key_type &key) {
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @return итератор на первый элемент
  */
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::iterator
-map<key_type, mapped_type>::begin() {
+template <typename key_type, typename mapped_type, typename Allocator>
+typename map<key_type, mapped_type, Allocator>::iterator
+map<key_type, mapped_type, Allocator>::begin() {
   Node *tmp = root_;
   while (tmp && tmp->left) {
     tmp = tmp->left;
@@ -318,11 +304,12 @@ map<key_type, mapped_type>::begin() {
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @return итератор на конец
  */
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::iterator
-map<key_type, mapped_type>::end() {
+template <typename key_type, typename mapped_type, typename Allocator>
+typename map<key_type, mapped_type, Allocator>::iterator
+map<key_type, mapped_type, Allocator>::end() {
   return iterator(nullptr);
 }
 
@@ -330,10 +317,11 @@ map<key_type, mapped_type>::end() {
  * @brief Проверяет, пуст ли контейнер
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @return true, если контейнер пуст - иначе false
  */
-template <typename key_type, typename mapped_type>
-bool map<key_type, mapped_type>::empty() {
+template <typename key_type, typename mapped_type, typename Allocator>
+bool map<key_type, mapped_type, Allocator>::empty() {
   return size_ == 0;
 }
 
@@ -341,11 +329,12 @@ bool map<key_type, mapped_type>::empty() {
  * @brief Возвращает количество элементов
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @return количество элементов
  */
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::size_type
-map<key_type, mapped_type>::size() {
+template <typename key_type, typename mapped_type, typename Allocator>
+typename map<key_type, mapped_type, Allocator>::size_type
+map<key_type, mapped_type, Allocator>::size() {
   return size_;
 }
 
@@ -353,23 +342,40 @@ map<key_type, mapped_type>::size() {
  * @brief Возвращает максимально возможное количество элементов
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @return максимально возможное количество элементов
  */
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::size_type
-map<key_type, mapped_type>::max_size() {
-  return std::numeric_limits<map<key_type, mapped_type>::size_type>::max() -
-         std::numeric_limits<map<key_type, mapped_type>::size_type>::min();
+template <typename key_type, typename mapped_type, typename Allocator>
+typename map<key_type, mapped_type, Allocator>::size_type
+map<key_type, mapped_type, Allocator>::max_size() {
+  return std::numeric_limits<size_type>::max() -
+         std::numeric_limits<size_type>::min();
 }
 
 /**
  * @brief Очищает содержимое контейнера
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  */
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::clear() {
-  Node *tmp = root_;
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::clear() {
+  DestroyTree(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+/**
+ * @brief Удаление всех узлов дерева без рекурсии
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param node Указатель на корень удаляемого дерева
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::DestroyTree(Node *node) {
+  Node *tmp = node;
   Node *tmp_parent = nullptr;
   while (tmp != nullptr) {
     if (tmp->left) {
@@ -385,7 +391,7 @@ void map<key_type, mapped_type>::clear() {
           tmp_parent->right = nullptr;
         }
       }
-      delete tmp;
+      destroy_node(alloc_, tmp);
       tmp = tmp_parent;
       tmp_parent = nullptr;
     }
@@ -398,22 +404,18 @@ void map<key_type, mapped_type>::clear() {
  * выполнена вставка
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param value элемент для вставки
  * @return пара итератора и логического значения - была ли вставка
  */
 
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert(
+template <typename key_type, typename mapped_type, typename Allocator>
+std::pair<typename map<key_type, mapped_type, Allocator>::iterator, bool>
+map<key_type, mapped_type, Allocator>::insert(
     const std::pair<const key_type, mapped_type> &value) {
-  Node *dest = insertRecursive(root_, value);
-  if (dest) size_++;
-  if (size_ == 1 && dest) {
-    root_ = dest;
-  }
-  return std::pair<typename map<key_type, mapped_type>::iterator, bool>(
-      map<key_type, mapped_type>::iterator((Node *)dest),
-      (dest) ? true : false);
+  std::pair<Node *, bool> dest = insertNode(value.first, value.second);
+  return std::pair<iterator, bool>(
+      iterator(dest.first), dest.second);
 }
 
 /**
@@ -422,23 +424,18 @@ map<key_type, mapped_type>::insert(
  * ли место вставка
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param key ключ
  * @param obj значение
  * @return пара итератора и логического значения - была ли вставка
  */
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert(const key_type &key,
+template <typename key_type, typename mapped_type, typename Allocator>
+std::pair<typename map<key_type, mapped_type, Allocator>::iterator, bool>
+map<key_type, mapped_type, Allocator>::insert(const key_type &key,
                                    const mapped_type &obj) {
-  Node *dest = insertRecursive(root_, std::make_pair(key, obj));
-  if (dest) size_++;
-
-  if (size_ == 1 && dest) {
-    root_ = dest;
-  }
-  return std::pair<typename map<key_type, mapped_type>::iterator, bool>(
-      map<key_type, mapped_type>::iterator((Node *)dest),
-      (dest) ? true : false);
+  std::pair<Node *, bool> dest = insertNode(key, obj);
+  return std::pair<iterator, bool>(
+      iterator(dest.first), dest.second);
 }
 
 /**
@@ -446,65 +443,37 @@ map<key_type, mapped_type>::insert(const key_type &key,
  * уже существует
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param key ключ
  * @param obj значение
  * @return пара итератора и логического значения - была ли вставка
  */
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert_or_assign(const key_type &key,
+template <typename key_type, typename mapped_type, typename Allocator>
+std::pair<typename map<key_type, mapped_type, Allocator>::iterator, bool>
+map<key_type, mapped_type, Allocator>::insert_or_assign(const key_type &key,
                                              const mapped_type &obj) {
-  Node *dest = root_;
-  bool is_inserted = false;
-  while (dest != nullptr && dest->key != key && !is_inserted) {
-    if (dest->key < key) {
-      if (dest->right == nullptr) {
-        dest->right = new Node(key, obj);
-        dest->right->parent = dest;
-        is_inserted = true;
-        size_++;
-      }
-      dest = dest->right;
-    } else if (dest->key > key) {
-      if (dest->left == nullptr) {
-        dest->left = new Node(key, obj);
-        dest->left->parent = dest;
-        is_inserted = true;
-        size_++;
-      }
-      dest = dest->left;
-    }
+  std::pair<Node *, bool> dest = insertNode(key, obj);
+  if (!dest.second) {
+    dest.first->data = obj;
   }
-  if (!dest) {
-    dest = new Node(key, obj);
-    is_inserted = true;
-    size_++;
-  } else if (dest->key == key) {
-    dest->data = obj;
-  }
-  if (size_ == 1 && dest) {
-    root_ = dest;
-  }
-  return std::pair<typename map<key_type, mapped_type>::iterator, bool>(
-      map<key_type, mapped_type>::iterator((Node *)dest),
-      (dest) ? true : false);
+  return std::pair<iterator, bool>(
+      iterator(dest.first), true);
 }
 
 /**
  * @brief Удаляет элемент в указанной позиции
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param pos позиция элемента
  */
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::erase(iterator pos) {
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::erase(iterator pos) {
   if (pos.m_node != nullptr) {
     changeConnections(pos);
-    delete pos.m_node;
-    pos.m_node = nullptr;
+    destroy_node(alloc_, pos.m_node);
     pos.m_node = nullptr;
     size_--;
-    if (size_ == 0) root_ = nullptr;
   }
 }
 
@@ -512,10 +481,11 @@ void map<key_type, mapped_type>::erase(iterator pos) {
  * @brief Меняет содержимое контейнеров местами
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param other контейнер для замены
  */
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::swap(map<key_type, mapped_type> &other) {
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::swap(map &other) {
   if (this != &other) {
     std::swap(root_, other.root_);
     std::swap(size_, other.size_);
@@ -526,38 +496,32 @@ void map<key_type, mapped_type>::swap(map<key_type, mapped_type> &other) {
  * @brief Объединяет узлы из другого контейнера
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param other контейнер для объединения
  */
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::merge(map<key_type, mapped_type> &other) {
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::merge(map &other) {
   if (this != &other) {
     for (auto it = other.begin(); it != other.end();) {
-      if (!contains(it.m_node->key)) {
-        Node *tmp = root_;
-        Node *tmp_parent = nullptr;
-        bool is_left = false;
-        while (tmp) {
-          tmp_parent = tmp;
-          is_left = (tmp->key > it.m_node->key);
-          tmp = (is_left) ? tmp->left : tmp->right;
-        }
-        auto it_2 = it;
-        ++it;
-        if (other.size_ > 1) {
-          other.changeConnections(it_2);
+      Node *tmp = root_;
+      Node *tmp_parent = nullptr;
+      bool is_found = false;
+      while (tmp && !is_found) {
+        tmp_parent = tmp;
+        if (it.m_node->key < tmp->key) {
+          tmp = tmp->left;
+        } else if (tmp->key < it.m_node->key) {
+          tmp = tmp->right;
         } else {
-          other.root_ = nullptr;
+          is_found = true;
         }
+      }
+      auto it_2 = it;
+      ++it;
+      if (!is_found) {
+        other.changeConnections(it_2);
         other.size_--;
-        (is_left) ? tmp_parent->left = it_2.m_node
-                  : tmp_parent->right = it_2.m_node;
-        it_2.m_node->parent = tmp_parent;
-        it_2.m_node->left = nullptr;
-        it_2.m_node->right = nullptr;
-        size_++;
-
-      } else {
-        ++it;
+        attachNode(tmp_parent, it_2.m_node);
       }
     }
   }
@@ -568,21 +532,13 @@ void map<key_type, mapped_type>::merge(map<key_type, mapped_type> &other) {
  * ключу
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param key ключ
  * @return true если есть елемент с таким ключом - иначе false
  */
-template <typename key_type, typename mapped_type>
-bool map<key_type, mapped_type>::contains(const key_type &key) {
-  Node *tmp = this->root_;
-  while (tmp && tmp->key != key) {
-    if (tmp->key < key) {
-      tmp = tmp->right;
-    } else if (tmp->key > key) {
-      tmp = tmp->left;
-    }
-  }
-
-  return (tmp == nullptr) ? false : true;
+template <typename key_type, typename mapped_type, typename Allocator>
+bool map<key_type, mapped_type, Allocator>::contains(const key_type &key) {
+  return findNode(key) != nullptr;
 }
 
 /**
@@ -590,139 +546,391 @@ bool map<key_type, mapped_type>::contains(const key_type &key) {
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param key ключ для поиска
  * @return Итератор на найденое значение
  */
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::iterator map<key_type, mapped_type>::find(
-    const key_type &key) {
+template <typename key_type, typename mapped_type, typename Allocator>
+typename map<key_type, mapped_type, Allocator>::iterator
+map<key_type, mapped_type, Allocator>::find(const key_type &key) {
+  return iterator(findNode(key));
+}
+
+/**
+ * @brief Копирование бинарного дерева без рекурсии: обход в прямом порядке
+ * по ссылкам на родителей обоих деревьев, O(1) дополнительной памяти
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type  тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param node Указатель на корень копируемого дерева
+ * @return Указатель на корень нового дерева
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+typename map<key_type, mapped_type, Allocator>::Node *
+map<key_type, mapped_type, Allocator>::CopyTree(const Node *node) {
+  Node *newroot = nullptr;
+  if (node != nullptr) {
+    newroot = create_node<Node>(alloc_, node->key, node->data);
+    newroot->red = node->red;
+    const Node *src = node;
+    Node *dst = newroot;
+    try {
+      while (src != nullptr) {
+        if (src->left != nullptr && dst->left == nullptr) {
+          src = src->left;
+          dst->left = create_node<Node>(alloc_, src->key, src->data);
+          dst->left->parent = dst;
+          dst = dst->left;
+          dst->red = src->red;
+        } else if (src->right != nullptr && dst->right == nullptr) {
+          src = src->right;
+          dst->right = create_node<Node>(alloc_, src->key, src->data);
+          dst->right->parent = dst;
+          dst = dst->right;
+          dst->red = src->red;
+        } else {
+          src = (src == node) ? nullptr : src->parent;
+          dst = dst->parent;
+        }
+      }
+    } catch (...) {
+      DestroyTree(newroot);
+      throw;
+    }
+  }
+  return newroot;
+}
+
+/**
+ * @brief Поиск узла по ключу
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param key ключ для поиска
+ * @return указатель на узел или nullptr, если ключа нет
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+typename map<key_type, mapped_type, Allocator>::Node *
+map<key_type, mapped_type, Allocator>::findNode(const key_type &key) const {
   Node *tmp = root_;
-  while (tmp && tmp->key != key) {
+  while (tmp) {
     if (key < tmp->key) {
       tmp = tmp->left;
-    } else {
+    } else if (tmp->key < key) {
       tmp = tmp->right;
+    } else {
+      break;
     }
   }
-  return map<key_type, mapped_type>::iterator((Node *)tmp);
+  return tmp;
 }
 
 /**
- * @brief Копирование бинарного дерева
+ * @brief Итеративная вставка узла с балансировкой
  *
  * @tparam key_type тип ключа
- * @tparam mapped_type  тип хранимых данных
- * @param node Указатель на узел дерева
- * @param parent Указатель на родителя
- * @return Указатель на новый узел
- */
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::Node *map<key_type, mapped_type>::CopyTree(
-    const Node &node, Node *parent) {
-  Node *newnode = new Node();
-  newnode->data = node.data;
-  newnode->key = node.key;
-  newnode->parent = parent;
-  if (node.left != nullptr) {
-    newnode->left = CopyTree(*node.left, newnode);
-  } else {
-    newnode->left = nullptr;
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param key ключ
+ * @param obj значение
+ * @return пара указателя на узел с ключом и логического значения - была ли
+ * вставка
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+std::pair<typename map<key_type, mapped_type, Allocator>::Node *, bool>
+map<key_type, mapped_type, Allocator>::insertNode(const key_type &key,
+                                       const mapped_type &obj) {
+  Node *current = root_;
+  Node *parent = nullptr;
+  while (current) {
+    parent = current;
+    if (key < current->key) {
+      current = current->left;
+    } else if (current->key < key) {
+      current = current->right;
+    } else {
+      return std::pair<Node *, bool>(current, false);
+    }
   }
-  if (node.right != nullptr) {
-    newnode->right = CopyTree(*node.right, newnode);
+  Node *node = create_node<Node>(alloc_, key, obj);
+  attachNode(parent, node);
+  return std::pair<Node *, bool>(node, true);
+}
+
+/**
+ * @brief Подвешивает отдельный узел к листовой позиции родителя и
+ * восстанавливает свойства красно-черного дерева
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param parent родитель нового узла (nullptr для пустого дерева)
+ * @param node узел для вставки
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::attachNode(Node *parent,
+                                                       Node *node) {
+  node->parent = parent;
+  node->left = nullptr;
+  node->right = nullptr;
+  node->red = true;
+  if (!parent) {
+    root_ = node;
+  } else if (node->key < parent->key) {
+    parent->left = node;
   } else {
-    newnode->right = nullptr;
+    parent->right = node;
   }
-  return newnode;
+  size_++;
+  insertFixup(node);
 }
 
 /**
- * @brief Рекурсивная вставка узла
+ * @brief Заменяет поддерево узла поддеревом потомка
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
- * @param current указатель на текущий узел
- * @param value пара ключ-значение для вставки
- * @param parent родитель текущего узла
- * @return указатель на новый узел
- */
-template <typename key_type, typename mapped_type>
-typename map<key_type, mapped_type>::Node *
-map<key_type, mapped_type>::insertRecursive(
-    Node *&current, const std::pair<const key_type, mapped_type> &value,
-    Node *parent) {
-  Node *tmp = nullptr;
-  if (current == nullptr) {
-    current = new Node(value.first, value.second);
-    current->parent = parent;
-    tmp = current;
-  } else if (current->key == value.first) {
-    tmp = nullptr;
+ * @tparam Allocator тип аллокатора узлов
+ * @param node заменяемый узел
+ * @param child узел, встающий на его место (может быть nullptr)
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::transplant(Node *node,
+                                                       Node *child) {
+  if (!node->parent) {
+    root_ = child;
+  } else if (node == node->parent->left) {
+    node->parent->left = child;
   } else {
-    if (value.first < current->key) {
-      tmp = insertRecursive(current->left, value, current);
-    } else if (value.first > current->key) {
-      tmp = insertRecursive(current->right, value, current);
+    node->parent->right = child;
+  }
+  if (child) child->parent = node->parent;
+}
+
+/**
+ * @brief Левый поворот вокруг узла
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param node узел, правый потомок которого поднимается на его место
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::rotateLeft(Node *node) {
+  Node *pivot = node->right;
+  node->right = pivot->left;
+  if (pivot->left) pivot->left->parent = node;
+  transplant(node, pivot);
+  pivot->left = node;
+  node->parent = pivot;
+}
+
+/**
+ * @brief Правый поворот вокруг узла
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param node узел, левый потомок которого поднимается на его место
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::rotateRight(Node *node) {
+  Node *pivot = node->left;
+  node->left = pivot->right;
+  if (pivot->right) pivot->right->parent = node;
+  transplant(node, pivot);
+  pivot->right = node;
+  node->parent = pivot;
+}
+
+/**
+ * @brief Восстанавливает свойства красно-черного дерева после вставки
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param node только что вставленный (красный) узел
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::insertFixup(Node *node) {
+  while (node != root_ && node->parent->red) {
+    Node *parent = node->parent;
+    Node *grand = parent->parent;
+    if (parent == grand->left) {
+      Node *uncle = grand->right;
+      if (uncle && uncle->red) {
+        parent->red = false;
+        uncle->red = false;
+        grand->red = true;
+        node = grand;
+      } else {
+        if (node == parent->right) {
+          node = parent;
+          rotateLeft(node);
+          parent = node->parent;
+        }
+        parent->red = false;
+        grand->red = true;
+        rotateRight(grand);
+      }
+    } else {
+      Node *uncle = grand->left;
+      if (uncle && uncle->red) {
+        parent->red = false;
+        uncle->red = false;
+        grand->red = true;
+        node = grand;
+      } else {
+        if (node == parent->left) {
+          node = parent;
+          rotateRight(node);
+          parent = node->parent;
+        }
+        parent->red = false;
+        grand->red = true;
+        rotateLeft(grand);
+      }
     }
   }
-  return tmp;
+  root_->red = false;
+}
+
+/**
+ * @brief Восстанавливает свойства красно-черного дерева после удаления
+ * черного узла
+ *
+ * @tparam key_type тип ключа
+ * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
+ * @param node узел, занявший место удаленного (может быть nullptr)
+ * @param parent родитель этой позиции
+ */
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::eraseFixup(Node *node,
+                                                       Node *parent) {
+  while (node != root_ && (!node || !node->red)) {
+    if (node == parent->left) {
+      Node *sibling = parent->right;
+      if (sibling->red) {
+        sibling->red = false;
+        parent->red = true;
+        rotateLeft(parent);
+        sibling = parent->right;
+      }
+      if ((!sibling->left || !sibling->left->red) &&
+          (!sibling->right || !sibling->right->red)) {
+        sibling->red = true;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (!sibling->right || !sibling->right->red) {
+          sibling->left->red = false;
+          sibling->red = true;
+          rotateRight(sibling);
+          sibling = parent->right;
+        }
+        sibling->red = parent->red;
+        parent->red = false;
+        if (sibling->right) sibling->right->red = false;
+        rotateLeft(parent);
+        node = root_;
+      }
+    } else {
+      Node *sibling = parent->left;
+      if (sibling->red) {
+        sibling->red = false;
+        parent->red = true;
+        rotateRight(parent);
+        sibling = parent->left;
+      }
+      if ((!sibling->left || !sibling->left->red) &&
+          (!sibling->right || !sibling->right->red)) {
+        sibling->red = true;
+        node = parent;
+        parent = node->parent;
+      } else {
+        if (!sibling->left || !sibling->left->red) {
+          sibling->right->red = false;
+          sibling->red = true;
+          rotateLeft(sibling);
+          sibling = parent->left;
+        }
+        sibling->red = parent->red;
+        parent->red = false;
+        if (sibling->left) sibling->left->red = false;
+        rotateRight(parent);
+        node = root_;
+      }
+    }
+  }
+  if (node) node->red = false;
 }
+
 /**
- * Меняет связи между элемент при вырезании
+ * Меняет связи между элементами при вырезании узла из дерева и
+ * восстанавливает балансировку. Сам узел не удаляется.
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @param pos указатель на элемент
  */
-template <typename key_type, typename mapped_type>
-void map<key_type, mapped_type>::changeConnections(iterator pos) {
-  if (pos.m_node->left == nullptr && pos.m_node->right == nullptr) {
-    if (pos.m_node->parent && pos.m_node->parent->left == pos.m_node) {
-      pos.m_node->parent->left = nullptr;
-    } else if (pos.m_node->parent) {
-      pos.m_node->parent->right = nullptr;
-    }
-  } else if ((pos.m_node->left == nullptr && pos.m_node->right != nullptr) ||
-             (pos.m_node->left != nullptr && pos.m_node->right == nullptr)) {
-    if (!pos.m_node->parent) {
-      root_ = (pos.m_node->right) ? pos.m_node->right : pos.m_node->left;
-      root_->parent = nullptr;
-    } else if (pos.m_node->parent->left == pos.m_node) {
-      pos.m_node->parent->left =
-          (pos.m_node->right) ? pos.m_node->right : pos.m_node->left;
-      pos.m_node->parent->left->parent = pos.m_node->parent;
-    } else if (pos.m_node->parent->right == pos.m_node) {
-      pos.m_node->parent->right =
-          (pos.m_node->right) ? pos.m_node->right : pos.m_node->left;
-      pos.m_node->parent->right->parent = pos.m_node->parent;
-    }
+template <typename key_type, typename mapped_type, typename Allocator>
+void map<key_type, mapped_type, Allocator>::changeConnections(iterator pos) {
+  Node *node = pos.m_node;
+  Node *child = nullptr;
+  Node *child_parent = nullptr;
+  bool removed_red = node->red;
+  if (!node->left) {
+    child = node->right;
+    child_parent = node->parent;
+    transplant(node, node->right);
+  } else if (!node->right) {
+    child = node->left;
+    child_parent = node->parent;
+    transplant(node, node->left);
   } else {
-    Node *tmp = pos.m_node->right;
-    while (tmp->left) {
-      tmp = tmp->left;
+    Node *next = node->right;
+    while (next->left) {
+      next = next->left;
     }
-    tmp->left = pos.m_node->left;
-    pos.m_node->left->parent = tmp;
-    pos.m_node->right->parent = pos.m_node->parent;
-    if (pos.m_node == root_) {
-      root_ = pos.m_node->right;
+    removed_red = next->red;
+    child = next->right;
+    if (next->parent == node) {
+      child_parent = next;
+    } else {
+      child_parent = next->parent;
+      transplant(next, next->right);
+      next->right = node->right;
+      next->right->parent = next;
     }
+    transplant(node, next);
+    next->left = node->left;
+    next->left->parent = next;
+    next->red = node->red;
   }
+  if (!removed_red) eraseFixup(child, child_parent);
+  node->left = nullptr;
+  node->right = nullptr;
+  node->parent = nullptr;
 }
 
 /**
  *
  * @tparam key_type тип ключа
  * @tparam mapped_type тип хранимых данных
+ * @tparam Allocator тип аллокатора узлов
  * @tparam Args тип входящих аргументов
  * @param args аргументы
  * @return вектор пар
  */
-template <typename key_type, typename mapped_type>
+template <typename key_type, typename mapped_type, typename Allocator>
 template <typename... Args>
-std::vector<std::pair<typename map<key_type, mapped_type>::iterator, bool>>
-map<key_type, mapped_type>::insert_many(Args &&...args) {
-  std::vector<std::pair<typename map<key_type, mapped_type>::iterator, bool>>
-      vec;
+std::vector<
+    std::pair<typename map<key_type, mapped_type, Allocator>::iterator, bool>>
+map<key_type, mapped_type, Allocator>::insert_many(Args &&...args) {
+  std::vector<std::pair<iterator, bool>> vec;
   std::vector<std::pair<key_type, mapped_type>> tmp{args...};
   for (auto i : tmp) {
     vec.push_back(insert(i));
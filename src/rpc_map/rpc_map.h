@@ -1,9 +1,12 @@
 #ifndef RPC_MAP_H_
 #define RPC_MAP_H_
 
+#include "../rpc_allocator/rpc_allocator.h"
+
 namespace rpc {
 
-template <typename Key, typename T>
+template <typename Key, typename T,
+          typename Allocator = pool_allocator<std::pair<const Key, T>>>
 class map {
  public:
   using key_type = Key;
@@ -12,6 +15,7 @@ class map {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
  private:
   typedef struct Node {
@@ -20,19 +24,24 @@ class map {
     Node *left;
     Node *right;
     Node *parent;
+    bool red;
 
-    Node() : left(nullptr), right(nullptr), parent(nullptr) {}
+    Node() : left(nullptr), right(nullptr), parent(nullptr), red(true) {}
     Node(const key_type &key, const mapped_type &data)
         : key(key),
           data(data),
           left(nullptr),
           right(nullptr),
-          parent(nullptr) {}
+          parent(nullptr),
+          red(true) {}
 
   } Node;
+  using node_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
 
   Node *root_ = nullptr;
   size_type size_ = 0;
+  node_allocator alloc_;
 
  public:
   template <typename key_type, typename mapped_type>
@@ -63,10 +72,17 @@ class map {
 
  private:
   void changeConnections(iterator pos);
-  Node *CopyTree(const Node &node, Node *parent = nullptr);
-  Node *insertRecursive(Node *&current,
-                        const std::pair<const key_type, mapped_type> &value,
-                        Node *parent = nullptr);
+  Node *CopyTree(const Node *node);
+  void DestroyTree(Node *node);
+  Node *findNode(const key_type &key) const;
+  std::pair<Node *, bool> insertNode(const key_type &key,
+                                     const mapped_type &obj);
+  void attachNode(Node *parent, Node *node);
+  void transplant(Node *node, Node *child);
+  void rotateLeft(Node *node);
+  void rotateRight(Node *node);
+  void insertFixup(Node *node);
+  void eraseFixup(Node *node, Node *parent);
 
  public:
   map();
@@ -0,0 +1,225 @@
+#ifndef RPC_MPMC_QUEUE_H
+#define RPC_MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace rpc {
+
+/// @brief Ограниченная очередь для нескольких производителей и нескольких
+/// потребителей без блокировок (схема Вьюкова). У каждой ячейки кольцевого
+/// буфера есть номер последовательности: ячейка с номером pos свободна для
+/// записи с позиции pos, с номером pos + 1 - готова к чтению с позиции pos.
+/// Производители и потребители захватывают позиции через CAS на общих
+/// счетчиках, а данные передаются через номер ячейки, поэтому потоки
+/// конкурируют только за счетчик своей стороны.
+/// Перемещение и разрушение T не должны бросать исключений: ячейку,
+/// захваченную под запись, нельзя вернуть.
+/// Методы try_* не ждут, push и pop(value) ждут свободную или заполненную
+/// ячейку. front() нет: другой потребитель может забрать элемент сразу
+/// после проверки.
+/// @tparam T тип элементов
+template <typename T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible_v<T> &&
+                    std::is_nothrow_move_assignable_v<T> &&
+                    std::is_nothrow_destructible_v<T>,
+                "mpmc_queue requires nothrow move and destruction");
+
+ public:
+  /// @brief Тип элемента, хранящегося в контейнере
+  using value_type = T;
+
+  /// @brief Тип ссылки на элемент
+  using reference = value_type &;
+
+  /// @brief Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+
+  /// @brief Тип размера контейнера (стандартный тип size_t)
+  using size_type = size_t;
+
+  /// @brief Емкость очереди по умолчанию
+  static constexpr size_type kDefaultCapacity = 1024;
+
+  /// @brief Конструктор, выделяет буфер
+  /// @param capacity емкость, округляется вверх до степени двойки
+  explicit mpmc_queue(size_type capacity = kDefaultCapacity)
+      : _capacity(round_up(capacity)),
+        _cells(cell_traits::allocate(_alloc, _capacity)) {
+    for (size_type i = 0; i < _capacity; ++i) {
+      cell_traits::construct(_alloc, _cells + i, i);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  /// @brief Деструктор, вызывается, когда потоки закончили работу с очередью
+  ~mpmc_queue() {
+    const size_type tail = _enqueue_pos.load(std::memory_order_relaxed);
+    for (size_type i = _dequeue_pos.load(std::memory_order_relaxed); i != tail;
+         ++i) {
+      _cells[i & (_capacity - 1)].value()->~value_type();
+    }
+    for (size_type i = 0; i < _capacity; ++i) {
+      cell_traits::destroy(_alloc, _cells + i);
+    }
+    cell_traits::deallocate(_alloc, _cells, _capacity);
+  }
+
+  // Modifiers
+  /// @brief Помещает элемент в конец очереди, если есть свободная ячейка
+  /// @param value значение
+  /// @return true, если элемент помещен
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  /// @brief Создает элемент в конце очереди, если есть свободная ячейка.
+  /// Если конструктор может бросить исключение, элемент создается до захвата
+  /// ячейки и затем перемещается в нее
+  /// @param ...args аргументы конструктора элемента
+  /// @return true, если элемент создан
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible_v<value_type, Args &&...>) {
+      size_type pos;
+      Cell *cell = acquire_push(pos);
+      if (!cell) return false;
+      new (cell->storage) value_type(std::forward<Args>(args)...);
+      cell->sequence.store(pos + 1, std::memory_order_release);
+      return true;
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      return try_emplace(std::move(value));
+    }
+  }
+
+  /// @brief Помещает элемент в конец очереди, ожидая свободную ячейку
+  /// @param value значение
+  void push(const_reference value) {
+    while (!try_push(value)) std::this_thread::yield();
+  }
+  void push(value_type &&value) {
+    while (!try_push(std::move(value))) std::this_thread::yield();
+  }
+
+  /// @brief Извлекает элемент из головы очереди, если она не пуста
+  /// @param value куда переместить элемент
+  /// @return true, если элемент извлечен
+  bool try_pop(reference value) {
+    size_type pos = _dequeue_pos.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+      cell = _cells + (pos & (_capacity - 1));
+      const size_type seq = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (_dequeue_pos.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = _dequeue_pos.load(std::memory_order_relaxed);
+      }
+    }
+    value_type *slot = cell->value();
+    value = std::move(*slot);
+    slot->~value_type();
+    cell->sequence.store(pos + _capacity, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief Извлекает элемент из головы очереди, ожидая его появления
+  /// @param value куда переместить элемент
+  void pop(reference value) {
+    while (!try_pop(value)) std::this_thread::yield();
+  }
+
+  // Capacity
+  /// @brief Проверяет очередь на пустоту. Результат может устареть сразу
+  /// после возврата
+  /// @return true, если очередь пустая
+  bool empty() const { return size() == 0; }
+
+  /// @brief Возвращает примерное количество элементов: захваченные под
+  /// запись, но еще не записанные ячейки тоже считаются
+  /// @return количество элементов в очереди
+  size_type size() const {
+    const size_type head = _dequeue_pos.load(std::memory_order_acquire);
+    const size_type tail = _enqueue_pos.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  /// @brief Емкость очереди
+  size_type capacity() const { return _capacity; }
+
+ private:
+  /// @brief Размер кэш-линии, по которому разносятся счетчики
+  static constexpr size_t kCacheLineSize = 64;
+
+  /// @brief Ячейка буфера: номер последовательности и место под элемент
+  struct Cell {
+    explicit Cell(size_type seq) : sequence(seq) {}
+
+    value_type *value() {
+      return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+
+    std::atomic<size_type> sequence;
+    alignas(value_type) unsigned char storage[sizeof(value_type)];
+  };
+
+  using cell_allocator = std::allocator<Cell>;
+  using cell_traits = std::allocator_traits<cell_allocator>;
+
+  static size_type round_up(size_type capacity) {
+    size_type result = 2;
+    while (result < capacity) result *= 2;
+    return result;
+  }
+
+  /// @brief Захватывает ячейку под запись
+  /// @param pos позиция захваченной ячейки
+  /// @return ячейка или nullptr, если очередь заполнена
+  Cell *acquire_push(size_type &pos) {
+    pos = _enqueue_pos.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell *cell = _cells + (pos & (_capacity - 1));
+      const size_type seq = cell->sequence.load(std::memory_order_acquire);
+      const intptr_t diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (_enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          return cell;
+        }
+      } else if (diff < 0) {
+        return nullptr;
+      } else {
+        pos = _enqueue_pos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Общие поля, только для чтения
+  cell_allocator _alloc;
+  const size_type _capacity;
+  Cell *const _cells;
+
+  alignas(kCacheLineSize) std::atomic<size_type> _enqueue_pos{0};
+  alignas(kCacheLineSize) std::atomic<size_type> _dequeue_pos{0};
+};
+
+}  // namespace rpc
+
+#endif  // RPC_MPMC_QUEUE_H
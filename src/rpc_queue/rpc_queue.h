@@ -2,13 +2,20 @@
 #define RPC_QUEUE_H
 
 #include <cstddef>
-#include <iostream>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
 
 namespace rpc {
 
-/// @brief Шаблонный класс для контейнера "очередь" (queue)
+/// @brief Шаблонный класс для контейнера "очередь" (queue). Элементы хранятся
+/// в кольцевом буфере, емкость которого - степень двойки, поэтому позиция
+/// элемента вычисляется маской, а не делением. При заполнении буфер
+/// удваивается, элементы переносятся в начало нового буфера.
 /// @tparam T - тип элементов, содержащихся в контейнере
-template <typename T>
+/// @tparam Allocator - аллокатор буфера очереди
+template <typename T, typename Allocator = std::allocator<T>>
 class queue {
  public:
   // Queue Member type
@@ -24,51 +31,42 @@ class queue {
   /// @brief Тип размера контейнера (стандартный тип size_t)
   using size_type = size_t;
 
+  /// @brief Тип аллокатора
+  using allocator_type = Allocator;
+
  private:
-  /// @brief Вложенный тип (односвязный список)
-  // template <typename value_type>
-  class Node {
-   public:
-    /// @brief Значение элемента списка (информационное поле)
-    value_type value;
-
-    /// @brief Указатель на следующий элемент списка
-    Node *next;
-
-    /// @brief Указатель на предыдущий элемент списка
-    Node *prev;
-
-    /// @brief Конструктор класса Node
-    /// @param val переданное значение для инициализации элемента списка
-    explicit Node(const value_type &val)
-        : value(val), next(nullptr), prev(nullptr) {};
-
-    /// @brief Деструктор класса Node
-    ~Node() = default;  //{
-                        // delete next;
-                        // delete prev;
-    //};
-  };
+  /// @brief Операции над аллокатором
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  /// @brief Емкость буфера при первой вставке
+  static constexpr size_type kMinCapacity = 8;
+
+  /// @brief Экземпляр аллокатора буфера
+  allocator_type _alloc;
+
+  /// @brief Кольцевой буфер
+  value_type *_data;
+
+  /// @brief Емкость буфера: 0 или степень двойки
+  size_type _capacity;
+
+  /// @brief Позиция элемента в голове очереди (который сейчас уйдет)
+  size_type _head;
 
  public:
   // Fields
   /// @brief Длина очереди
   size_type _size;
 
-  /// @brief Указатель на элемент в голове очереди (который сейчас уйдет)
-  Node *_head;
-
-  /// @brief Указатель на элемент в хвосте очереди (который только что пришел)
-  Node *_tail;
-
   // Member functions
   /// @brief Конструктор по умолчанию, создаёт пустую очередь
-  queue() : _size(0), _head(nullptr), _tail(nullptr) {};
+  queue() noexcept : _data(nullptr), _capacity(0), _head(0), _size(0) {};
 
   /// @brief Конструктор с параметром, создает очередь, инициализированную
   /// списком std::initializer_list
   /// @param items список, переданный для инициализации очереди
   queue(std::initializer_list<value_type> const &items) : queue() {
+    if (items.size()) reallocate(capacity_for(items.size()));
     for (auto &i : items) {
       this->push(i);
     };
@@ -76,51 +74,59 @@ class queue {
 
   /// @brief Конструктор копирования
   /// @param q объект-очередь для копирования содержимого в создаваемый объект
-  queue(const queue &q) : queue() {
-    Node *tmp = q._head;
-    while (tmp != nullptr) {
-      this->push(tmp->value);
-      tmp = tmp->prev;
-    }
+  queue(const queue &q)
+      : _alloc(alloc_traits::select_on_container_copy_construction(q._alloc)),
+        _data(nullptr),
+        _capacity(0),
+        _head(0),
+        _size(0) {
+    if (q._size) reallocate(capacity_for(q._size));
+    for (size_type i = 0; i < q._size; ++i) this->push(q.element(i));
   }
 
   /// @brief Конструктор перемещения
   /// @param q объект-очередь для инициализации создаваемого объекта
-  queue(queue &&other) noexcept : queue() {
-    while (other._head) {
-      this->push(other.front());
-      other.pop();
-    }
-    other.~queue();
+  queue(queue &&other) noexcept
+      : _alloc(std::move(other._alloc)),
+        _data(other._data),
+        _capacity(other._capacity),
+        _head(other._head),
+        _size(other._size) {
+    other._data = nullptr;
+    other._capacity = 0;
+    other._head = 0;
+    other._size = 0;
   }
 
   /// @brief Деструктор класса
   ~queue() {
-    while (this->_size) {
-      this->pop();
-    }
+    clear();
+    deallocate(_data, _capacity);
   }
 
   /// @brief Перегрузка оператора присваивания
   /// @param q объект-очередь - источник значений для присваивания
-  queue &operator=(queue &q) noexcept {
-    if (this->_head) {
-      this->~queue();
-    }
-    Node *tmp = q._head;
-    while (tmp != nullptr) {
-      this->push(tmp->value);
-      tmp = tmp->prev;
+  queue &operator=(const queue &q) {
+    if (this != &q) {
+      queue tmp(q);
+      swap(tmp);
     }
     return *this;
   };
 
+  /// @brief Перегрузка оператора присваивания переносом
+  /// @param q объект-очередь - источник значений для присваивания
+  queue &operator=(queue &&q) noexcept {
+    if (this != &q) swap(q);
+    return *this;
+  };
+
   // Element access
   /// @brief Возвращает ссылку на первый элемент (который сейчас уйдет)
   /// @return ссылку на первый элемент в очереди
   const_reference front() {
-    if (_head)
-      return _head->value;
+    if (_size)
+      return element(0);
     else
       throw std::invalid_argument("Error: queue is empty!");
   };
@@ -129,8 +135,8 @@ class queue {
   /// пришел)
   /// @return ссылку на последний элемент в очереди
   const_reference back() {
-    if (_tail)
-      return _tail->value;
+    if (_size)
+      return element(_size - 1);
     else
       throw std::invalid_argument("Error: queue is empty!");
   };
@@ -148,39 +154,37 @@ class queue {
   /// @brief Помещает новый элемент в конец очереди
   /// @param value значение, которое надо поместить в конец очереди
   void push(const_reference value) {
-    Node *new_node = new Node(value);
-    if (!_head) {
-      _head = new_node;
-      _tail = new_node;
+    if (_size == _capacity) {
+      // value может быть элементом этой же очереди: копия снимается до
+      // переноса элементов в новый буфер
+      value_type tmp(value);
+      reallocate(_capacity ? _capacity * 2 : kMinCapacity);
+      alloc_traits::construct(_alloc, slot(_size), std::move(tmp));
     } else {
-      _tail->prev = new_node;
-      new_node->next = _tail;
-      _tail = new_node;
+      alloc_traits::construct(_alloc, slot(_size), value);
     }
-    new_node = nullptr;
-    delete new_node;
     _size++;
   };
 
   /// @brief Удаляет элемент с головы очереди
   void pop() {
-    if (!_head) {
+    if (!_size) {
       throw std::invalid_argument("Error: queue is empty!");
     } else {
-      Node *temp = _head->prev;
-      delete _head;
-      _head = temp;
-      if (!_head) _tail = nullptr;
+      alloc_traits::destroy(_alloc, _data + _head);
+      _head = (_head + 1) & (_capacity - 1);
       _size--;
     }
   };
 
   /// @brief Обменивает содержимое двух очередей между собой
   /// @param other объект-очередь для обмена
-  void swap(queue &other) {
-    queue<value_type> temp(*this);
-    *this = other;
-    other = temp;
+  void swap(queue &other) noexcept {
+    std::swap(_alloc, other._alloc);
+    std::swap(_data, other._data);
+    std::swap(_capacity, other._capacity);
+    std::swap(_head, other._head);
+    std::swap(_size, other._size);
   }
 
   // BONUS
@@ -192,6 +196,71 @@ class queue {
       push(arg);
     }
   };
+
+ private:
+  /// @brief Указатель на место i-го от головы элемента в буфере
+  value_type *slot(size_type i) const {
+    return _data + ((_head + i) & (_capacity - 1));
+  }
+
+  /// @brief i-й от головы элемент очереди
+  const_reference element(size_type i) const { return *slot(i); }
+
+  /// @brief Наименьшая допустимая емкость буфера для n элементов
+  static size_type capacity_for(size_type n) {
+    size_type capacity = kMinCapacity;
+    while (capacity < n) capacity *= 2;
+    return capacity;
+  }
+
+  /// @brief Выделяет неинициализированный буфер
+  /// @param n количество элементов
+  /// @return указатель на буфер или nullptr при n == 0
+  value_type *allocate(size_type n) {
+    return n ? alloc_traits::allocate(_alloc, n) : nullptr;
+  }
+
+  /// @brief Освобождает буфер без вызова деструкторов
+  /// @param ptr указатель на буфер
+  /// @param n количество элементов, под которое он выделялся
+  void deallocate(value_type *ptr, size_type n) noexcept {
+    if (ptr) alloc_traits::deallocate(_alloc, ptr, n);
+  }
+
+  /// @brief Разрушает все элементы, буфер сохраняется
+  void clear() noexcept {
+    for (; _size; --_size) {
+      alloc_traits::destroy(_alloc, _data + _head);
+      _head = (_head + 1) & (_capacity - 1);
+    }
+    _head = 0;
+  }
+
+  /// @brief Переносит элементы в новый буфер емкостью capacity, голова
+  /// оказывается в его начале. Элементы перемещаются, если перемещение не
+  /// бросает исключений, иначе копируются; при исключении очередь не
+  /// меняется
+  /// @param capacity новая емкость, степень двойки не меньше _size
+  void reallocate(size_type capacity) {
+    value_type *tmp = allocate(capacity);
+    size_type k = 0;
+    try {
+      for (; k < _size; ++k) {
+        alloc_traits::construct(_alloc, tmp + k,
+                                std::move_if_noexcept(*slot(k)));
+      }
+    } catch (...) {
+      for (size_type i = 0; i < k; ++i) alloc_traits::destroy(_alloc, tmp + i);
+      deallocate(tmp, capacity);
+      throw;
+    }
+    size_type size = _size;
+    clear();
+    deallocate(_data, _capacity);
+    _data = tmp;
+    _capacity = capacity;
+    _size = size;
+  }
 };  // class queue
 }  // namespace rpc
 
@@ -4,8 +4,10 @@
 #include <iostream>
 #include <limits>
 
+#include "../rpc_allocator/rpc_allocator.h"
+
 namespace rpc {
-template <typename Key>
+template <typename Key, typename Allocator = pool_allocator<Key>>
 class set {
  public:
   using key_type = Key;
@@ -13,6 +15,7 @@ class set {
   using reference = value_type&;
   using const_reference = const value_type&;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
   // Constructors
   set() : _size(0), _root(nullptr) {}  // Default
@@ -21,8 +24,7 @@ class set {
     for (value_type i : items) insert(i);
   }
   set(const set& other) : _size(other._size) {
-    _root = nullptr;
-    if (other._root) recursive_copy(other._root, &_root);
+    _root = copy_tree(other._root);
   }  // Copy
   set(set&& other) {
     _size = other._size;
@@ -33,7 +35,7 @@ class set {
 
   // Destructor
   ~set() {
-    if (_root) delete _root;
+    destroy_tree(_root);
     _size = 0;
     _root = nullptr;
   }
@@ -41,6 +43,7 @@ class set {
   // Operator
   set& operator=(set&& s) {
     if (this != &s) {
+      destroy_tree(_root);
       _root = s._root;
       _size = s.size();
       s._root = nullptr;
@@ -55,24 +58,21 @@ class set {
     set_node* _left;
     set_node* _right;
     set_node* _parent;
+    int _height;
 
     set_node(value_type value)
-        : _value(value), _left(nullptr), _right(nullptr), _parent(nullptr) {}
+        : _value(value),
+          _left(nullptr),
+          _right(nullptr),
+          _parent(nullptr),
+          _height(1) {}
     set_node(const set_node& other)
         : _value(other._value),
           _left(other._left),
           _right(other._right),
-          _parent(other._parent) {}
-    ~set_node() {
-      if (_parent) {
-        if (_parent->_left == this)
-          _parent->_left = nullptr;
-        else
-          _parent->_right = nullptr;
-      }
-      if (_left) delete _left;
-      if (_right) delete _right;
-    }
+          _parent(other._parent),
+          _height(other._height) {}
+    ~set_node() = default;
 
     // 0 - no parents, 1/2 - left/right node
     int Side() {
@@ -96,18 +96,178 @@ class set {
       return tmp;
     }
   } typedef set_node;
+  using node_allocator = typename std::allocator_traits<
+      Allocator>::template rebind_alloc<set_node>;
 
   size_type _size;
   set_node* _root;
+  node_allocator _alloc;
+
+  // post-order walk over parent links, O(1) extra memory
+  void destroy_tree(set_node* node) {
+    while (node) {
+      if (node->_left) {
+        node = node->_left;
+      } else if (node->_right) {
+        node = node->_right;
+      } else {
+        set_node* parent = node->_parent;
+        if (parent) {
+          if (parent->_left == node)
+            parent->_left = nullptr;
+          else
+            parent->_right = nullptr;
+        }
+        destroy_node(_alloc, node);
+        node = parent;
+      }
+    }
+  }
 
-  void recursive_copy(set_node* from, set_node** to) {
+  // pre-order walk over parent links of both trees, O(1) extra memory
+  set_node* copy_tree(const set_node* from) {
+    set_node* root = nullptr;
     if (from) {
-      *to = new set_node(from->_value);
-      recursive_copy(from->_left, &((*to)->_left));
-      recursive_copy(from->_right, &((*to)->_right));
-      if ((*to)->_left) (*to)->_left->_parent = *to;
-      if ((*to)->_right) (*to)->_right->_parent = *to;
+      root = create_node<set_node>(_alloc, from->_value);
+      root->_height = from->_height;
+      const set_node* src = from;
+      set_node* dst = root;
+      try {
+        while (src) {
+          if (src->_left && !dst->_left) {
+            src = src->_left;
+            dst->_left = create_node<set_node>(_alloc, src->_value);
+            dst->_left->_parent = dst;
+            dst = dst->_left;
+          } else if (src->_right && !dst->_right) {
+            src = src->_right;
+            dst->_right = create_node<set_node>(_alloc, src->_value);
+            dst->_right->_parent = dst;
+            dst = dst->_right;
+          } else {
+            src = (src == from) ? nullptr : src->_parent;
+            dst = dst->_parent;
+            continue;
+          }
+          dst->_height = src->_height;
+        }
+      } catch (...) {
+        destroy_tree(root);
+        throw;
+      }
     }
+    return root;
+  }
+
+  // AVL balancing
+  static int height(set_node* node) { return node ? node->_height : 0; }
+
+  static void update_height(set_node* node) {
+    int left = height(node->_left), right = height(node->_right);
+    node->_height = (left > right ? left : right) + 1;
+  }
+
+  // puts child in place of node under node's parent
+  void replace_child(set_node* node, set_node* child) {
+    int side = node->Side();
+    if (side == 1)
+      node->_parent->_left = child;
+    else if (side == 2)
+      node->_parent->_right = child;
+    else
+      _root = child;
+    if (child) child->_parent = node->_parent;
+  }
+
+  set_node* rotate_left(set_node* node) {
+    set_node* pivot = node->_right;
+    replace_child(node, pivot);
+    node->_right = pivot->_left;
+    if (pivot->_left) pivot->_left->_parent = node;
+    pivot->_left = node;
+    node->_parent = pivot;
+    update_height(node);
+    update_height(pivot);
+    return pivot;
+  }
+
+  set_node* rotate_right(set_node* node) {
+    set_node* pivot = node->_left;
+    replace_child(node, pivot);
+    node->_left = pivot->_right;
+    if (pivot->_right) pivot->_right->_parent = node;
+    pivot->_right = node;
+    node->_parent = pivot;
+    update_height(node);
+    update_height(pivot);
+    return pivot;
+  }
+
+  // restores heights and balance on the path from node up to the root
+  void rebalance(set_node* node) {
+    while (node) {
+      update_height(node);
+      int balance = height(node->_left) - height(node->_right);
+      if (balance > 1) {
+        if (height(node->_left->_left) < height(node->_left->_right))
+          rotate_left(node->_left);
+        node = rotate_right(node);
+      } else if (balance < -1) {
+        if (height(node->_right->_right) < height(node->_right->_left))
+          rotate_right(node->_right);
+        node = rotate_left(node);
+      }
+      node = node->_parent;
+    }
+  }
+
+  // returns node with value or nullptr, parent gets the last visited node
+  set_node* lookup(const value_type& value, set_node** parent) {
+    set_node* temp = _root;
+    *parent = nullptr;
+    while (temp && value != temp->_value) {
+      *parent = temp;
+      temp = value < temp->_value ? temp->_left : temp->_right;
+    }
+    return temp;
+  }
+
+  void link_node(set_node* node, set_node* parent) {
+    node->_parent = parent;
+    if (!parent)
+      _root = node;
+    else if (node->_value < parent->_value)
+      parent->_left = node;
+    else
+      parent->_right = node;
+    _size++;
+    rebalance(parent);
+  }
+
+  // detaches node from the tree without deleting it
+  void unlink_node(set_node* cur) {
+    set_node* fix = cur->_parent;
+    if (cur->_left && cur->_right) {
+      set_node* next = cur->_right->NodeMin();
+      fix = next;
+      if (next->_parent != cur) {
+        fix = next->_parent;
+        replace_child(next, next->_right);
+        next->_right = cur->_right;
+        next->_right->_parent = next;
+      }
+      replace_child(cur, next);
+      next->_left = cur->_left;
+      next->_left->_parent = next;
+    } else {
+      replace_child(cur, cur->_left ? cur->_left : cur->_right);
+    }
+    cur->_parent = nullptr;
+    cur->_left = nullptr;
+    cur->_right = nullptr;
+    cur->_height = 1;
+    _size--;
+    rebalance(fix);
   }
 
   // Iterators
@@ -251,87 +411,21 @@ class set {
   iterator end() { return iterator(_root, true); }
 
   std::pair<iterator, bool> insert(const value_type& value) {
-    bool result = false;
-    set_node* temp = _root;
-    if (_size) {
-      while (temp != nullptr && value != temp->_value) {
-        if (value < temp->_value) {
-          if (temp->_left == nullptr) {
-            temp->_left = new set_node(value);
-            temp->_left->_parent = temp;
-            temp = temp->_left;
-            result = true;
-          } else
-            temp = temp->_left;
-        } else {
-          if (temp->_right == nullptr) {
-            temp->_right = new set_node(value);
-            temp->_right->_parent = temp;
-            temp = temp->_right;
-            result = true;
-          } else
-            temp = temp->_right;
-        }
-      }
-    } else {
-      _root = new set_node(value);
-      result = true;
-      temp = _root;
+    set_node* parent;
+    set_node* temp = lookup(value, &parent);
+    bool result = temp == nullptr;
+    if (result) {
+      temp = create_node<set_node>(_alloc, value);
+      link_node(temp, parent);
     }
-    iterator it(temp);
-    _size += result;
-    return std::pair<iterator, bool>(it, result);
+    return std::pair<iterator, bool>(iterator(temp), result);
   }
 
   void erase(iterator pos) {
     if (_size > 0 && !pos._end) {
       set_node* cur = pos.get_node();
-      if ((!cur->_left) != (!cur->_right)) {
-        set_node* next = cur->_left ? cur->_left : cur->_right;
-        int side = cur->Side();
-        if (side == 1)
-          cur->_parent->_left = next;
-        else if (side == 2)
-          cur->_parent->_right = next;
-        else
-          _root = next;
-        side = next->Side();
-        if (side == 1)
-          next->_parent->_left = nullptr;
-        else
-          next->_parent->_right = nullptr;
-        next->_parent = cur->_parent;
-        cur->_parent = nullptr;
-        cur->_left ? cur->_left = nullptr : cur->_right = nullptr;
-        delete cur;
-      } else if (cur->_left && cur->_right) {
-        set_node* temp = cur->_right->NodeMin();
-        int side = cur->Side();
-        if (side == 1)
-          cur->_parent->_left = temp;
-        else if (side == 2)
-          cur->_parent->_right = temp;
-        else
-          _root = temp;
-        side = temp->Side();
-        if (side == 1)
-          temp->_parent->_left = nullptr;
-        else
-          temp->_parent->_right = nullptr;
-        temp->_parent = cur->_parent;
-        temp->_right = cur->_right;
-        if (cur->_right) cur->_right->_parent = temp;
-        temp->_left = cur->_left;
-        if (cur->_left) cur->_left->_parent = temp;
-        cur->_parent = nullptr;
-        cur->_left = nullptr;
-        cur->_right = nullptr;
-        delete cur;
-      } else {
-        if (!cur->_parent) _root = nullptr;
-        delete cur;
-      }
-      _size--;
+      unlink_node(cur);
+      destroy_node(_alloc, cur);
     } else {
       throw std::out_of_range("Iterator is out of set range.");
     }
@@ -339,11 +433,11 @@ class set {
 
   void clear() {
     _size = 0;
-    if (_root) delete _root;
+    destroy_tree(_root);
     _root = nullptr;
   }
 
-  void swap(set<Key>& other) {
+  void swap(set& other) {
     set_node* temp = this->_root;
     size_type t = this->_size;
     this->_root = other._root;
@@ -353,8 +447,16 @@ class set {
   }
 
   void merge(set& other) {
-    for (iterator it = other.begin(); it != other.end(); ++it) {
-      this->insert(*it);
+    if (this != &other) {
+      for (iterator it = other.begin(); it != other.end();) {
+        set_node* node = it.get_node();
+        ++it;
+        set_node* parent;
+        if (!lookup(node->_value, &parent)) {
+          other.unlink_node(node);
+          link_node(node, parent);
+        }
+      }
     }
   }
 
@@ -0,0 +1,222 @@
+#ifndef RPC_SMALL_VECTOR_H
+#define RPC_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../rpc_vector/rpc_iterators.h"
+#include "../rpc_vector/rpc_vector_base.h"
+
+namespace rpc {
+
+/// @brief Вектор со встроенным буфером на N элементов (small buffer
+/// optimization). Пока элементов не больше N, они лежат внутри объекта и
+/// память не выделяется; при переполнении элементы переносятся в кучу и
+/// дальше растут как в rpc::vector. Интерфейс совпадает с rpc::vector,
+/// итераторы - те же указатели, подходят и обертки из rpc_iterators.h.
+/// Перемещение вектора со встроенным буфером переносит элементы по одному:
+/// оно O(N), а итераторы источника не переходят к приемнику.
+/// @tparam T тип элементов
+/// @tparam N емкость встроенного буфера
+/// @tparam Allocator аллокатор хранилища в куче
+/// @tparam GrowthPolicy правило роста емкости в куче
+template <typename T, size_t N, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = growth_2x>
+class small_vector : public vector_base<T, Allocator, GrowthPolicy, N> {
+  static_assert(N > 0, "small_vector needs a non-empty inline buffer");
+
+  /// @brief Хранилище, доступ к элементам, вставка и удаление
+  using base = vector_base<T, Allocator, GrowthPolicy, N>;
+
+ public:
+  using typename base::allocator_type;
+  using typename base::size_type;
+  using typename base::value_type;
+
+  /// @brief Итераторы-обертки rpc::vector, хранят тот же указатель
+  using VectorIterator = typename vector<T>::VectorIterator;
+  using VectorConstIterator = typename vector<T>::VectorConstIterator;
+
+ private:
+  using typename base::alloc_traits;
+  template <typename It>
+  using input_iterator_t = typename base::template input_iterator_t<It>;
+  using base::_alloc;
+  using base::_capacity;
+  using base::_data;
+  using base::_size;
+  using base::_stats;
+
+ public:
+  // Member functions
+  /// @brief Конструктор по умолчанию, элементы пойдут во встроенный буфер
+  small_vector() noexcept { reset_inline(); }
+
+  /// @brief Конструктор с параметром, создает вектор заданной длины
+  /// @param n заданная длина вектора
+  small_vector(size_type n) : small_vector() {
+    this->reserve(n);
+    for (; _size < n; ++_size) alloc_traits::construct(_alloc, _data + _size);
+  }
+
+  /// @brief Конструктор из списка std::initializer_list
+  /// @param items список, переданный для инициализации вектора
+  small_vector(std::initializer_list<value_type> const &items)
+      : small_vector() {
+    this->insert(this->cend(), items.begin(), items.end());
+  }
+
+  /// @brief Конструктор из диапазона [first, last)
+  /// @param first итератор на первый элемент
+  /// @param last итератор за последним элементом
+  template <typename InputIt, typename = input_iterator_t<InputIt>>
+  small_vector(InputIt first, InputIt last) : small_vector() {
+    this->insert(this->cend(), first, last);
+  }
+
+  /// @brief Конструктор из любого диапазона с begin() и end()
+  /// @param range диапазон, например std::vector или массив
+  template <typename Range>
+  small_vector(from_range_t, Range &&range) : small_vector() {
+    this->append_range(std::forward<Range>(range));
+  }
+
+  /// @brief Конструктор копирования
+  /// @param v объект-вектор для копирования содержимого
+  small_vector(const small_vector &v)
+      : base(alloc_traits::select_on_container_copy_construction(v._alloc)) {
+    reset_inline();
+    this->reserve(v._size);
+    try {
+      this->construct_range(v._data, v._size, _data);
+    } catch (...) {
+      this->release();
+      throw;
+    }
+    _size = v._size;
+  }
+
+  /// @brief Конструктор перемещения: хранилище в куче забирается целиком,
+  /// элементы встроенного буфера переносятся по одному
+  /// @param v объект-вектор для инициализации создаваемого объекта
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : base(std::move(v._alloc)) {
+    reset_inline();
+    take(v);
+  }
+
+  /// @brief Деструктор класса
+  ~small_vector() { this->release_all(); }
+
+  /// @brief Оператор присваивания копированием
+  /// @param v объект-вектор - источник значений
+  small_vector &operator=(const small_vector &v) {
+    if (this != &v) this->assign(v._data, v._data + v._size);
+    return *this;
+  }
+
+  /// @brief Оператор присваивания переносом
+  /// @param v объект-вектор - источник значений
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &v) {
+      this->clear();
+      take(v);
+    }
+    return *this;
+  }
+
+  // Capacity
+  /// @brief Емкость встроенного буфера
+  static constexpr size_type inline_capacity() noexcept { return N; }
+
+  /// @brief Элементы лежат во встроенном буфере
+  bool is_inline() const noexcept { return _data == inline_data(); }
+
+  /// @brief Освобождает неиспользуемую память кучи; если элементы помещаются
+  /// во встроенный буфер, переносит их туда
+  void shrink_to_fit() {
+    if (is_inline() || _capacity == _size) return;
+    if (_size > N) {
+      this->reallocate(_size);
+      return;
+    }
+    value_type *heap = _data;
+    size_type capacity = _capacity;
+    this->relocate(heap, heap + _size, inline_data());
+    this->record_realloc();
+    this->destroy_range(heap, heap + _size);
+    alloc_traits::deallocate(_alloc, heap, capacity);
+    reset_inline();
+  }
+
+  // Modifiers
+  /// @brief Обменивает содержимое с другим вектором
+  /// @param other вектор для обмена
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(_data, other._data);
+      std::swap(_size, other._size);
+      std::swap(_capacity, other._capacity);
+      std::swap(_alloc, other._alloc);
+      std::swap(_stats, other._stats);
+      return;
+    }
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+ private:
+  /// @brief Указатель на встроенный буфер
+  value_type *inline_data() noexcept {
+    return std::launder(reinterpret_cast<value_type *>(_buffer));
+  }
+  const value_type *inline_data() const noexcept {
+    return std::launder(reinterpret_cast<const value_type *>(_buffer));
+  }
+
+  /// @brief Делает хранилищем пустой встроенный буфер, прежнее хранилище
+  /// должно быть уже освобождено
+  void reset_inline() noexcept {
+    _data = inline_data();
+    _capacity = N;
+  }
+
+  /// @brief Забирает элементы и статистику v, оставляя его пустым. Пустой
+  /// приемник использует встроенный буфер
+  /// @param v источник
+  void take(small_vector &v) {
+    if (v.is_inline()) {
+      this->relocate(v._data, v._data + v._size, _data);
+      _size = v._size;
+      v.clear();
+    } else {
+      this->release();
+      _data = v._data;
+      _size = v._size;
+      _capacity = v._capacity;
+      v.reset_inline();
+      v._size = 0;
+    }
+    _stats = v._stats;
+    v._stats = growth_stats();
+  }
+
+  /// @brief Встроенный буфер на N элементов
+  alignas(value_type) unsigned char _buffer[N * sizeof(value_type)];
+};  // class small_vector
+
+}  // namespace rpc
+
+#endif  // RPC_SMALL_VECTOR_H
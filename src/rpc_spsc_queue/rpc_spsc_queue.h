@@ -0,0 +1,225 @@
+#ifndef RPC_SPSC_QUEUE_H
+#define RPC_SPSC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace rpc {
+
+/// @brief Ограниченная очередь для одного потока-производителя и одного
+/// потока-потребителя без блокировок. Элементы лежат в кольцевом буфере из
+/// Capacity ячеек; производитель меняет только хвост, потребитель - только
+/// голову, индексы публикуются парами release/acquire. Индексы и их копии
+/// на стороне другого потока разнесены по разным кэш-линиям, поэтому потоки
+/// не мешают друг другу, пока очередь не пуста и не заполнена.
+/// Методы try_* не ждут (wait-free). push ждёт свободную ячейку, pop и
+/// front, как в rpc::queue, бросают исключение на пустой очереди.
+/// Методы push* вызывает только производитель, pop*, front - только
+/// потребитель; empty и size можно вызывать из любого потока.
+/// @tparam T тип элементов
+/// @tparam Capacity емкость очереди, степень двойки
+template <typename T, size_t Capacity>
+class spsc_queue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "spsc_queue capacity must be a power of two");
+
+ public:
+  /// @brief Тип элемента, хранящегося в контейнере
+  using value_type = T;
+
+  /// @brief Тип ссылки на элемент
+  using reference = value_type &;
+
+  /// @brief Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+
+  /// @brief Тип размера контейнера (стандартный тип size_t)
+  using size_type = size_t;
+
+  /// @brief Конструктор по умолчанию, выделяет буфер на Capacity элементов
+  spsc_queue() : _data(alloc_traits::allocate(_alloc, Capacity)) {}
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  /// @brief Деструктор, вызывается, когда потоки закончили работу с очередью
+  ~spsc_queue() {
+    size_type tail = _tail.load(std::memory_order_relaxed);
+    for (size_type i = _head.load(std::memory_order_relaxed); i != tail; ++i) {
+      alloc_traits::destroy(_alloc, _data + (i & kMask));
+    }
+    alloc_traits::deallocate(_alloc, _data, Capacity);
+  }
+
+  // Producer
+  /// @brief Помещает элемент в конец очереди, если есть свободная ячейка
+  /// @param value значение
+  /// @return true, если элемент помещен
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+
+  /// @brief Создает элемент в конце очереди, если есть свободная ячейка
+  /// @param ...args аргументы конструктора элемента
+  /// @return true, если элемент создан
+  template <typename... Args>
+  bool try_emplace(Args &&...args) {
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head_cache == Capacity) {
+      _head_cache = _head.load(std::memory_order_acquire);
+      if (tail - _head_cache == Capacity) return false;
+    }
+    alloc_traits::construct(_alloc, _data + (tail & kMask),
+                            std::forward<Args>(args)...);
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief Помещает элемент в конец очереди, ожидая свободную ячейку
+  /// @param value значение
+  void push(const_reference value) {
+    while (!try_push(value)) std::this_thread::yield();
+  }
+  void push(value_type &&value) {
+    while (!try_push(std::move(value))) std::this_thread::yield();
+  }
+
+  /// @brief Помещает в очередь до n элементов, начиная с first, и публикует
+  /// их одной записью хвоста
+  /// @param first итератор на первый элемент
+  /// @param n число элементов
+  /// @return число помещенных элементов
+  template <typename InputIt>
+  size_type push_n(InputIt first, size_type n) {
+    const size_type tail = _tail.load(std::memory_order_relaxed);
+    if (Capacity - (tail - _head_cache) < n) {
+      _head_cache = _head.load(std::memory_order_acquire);
+    }
+    n = std::min(n, Capacity - (tail - _head_cache));
+    size_type i = 0;
+    try {
+      for (; i < n; ++i, ++first) {
+        alloc_traits::construct(_alloc, _data + ((tail + i) & kMask), *first);
+      }
+    } catch (...) {
+      _tail.store(tail + i, std::memory_order_release);
+      throw;
+    }
+    _tail.store(tail + n, std::memory_order_release);
+    return n;
+  }
+
+  // Consumer
+  /// @brief Извлекает элемент из головы очереди, если она не пуста
+  /// @param value куда переместить элемент
+  /// @return true, если элемент извлечен
+  bool try_pop(reference value) {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    if (!readable(head, 1)) return false;
+    value_type *slot = _data + (head & kMask);
+    value = std::move(*slot);
+    alloc_traits::destroy(_alloc, slot);
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// @brief Возвращает ссылку на первый элемент (который сейчас уйдет)
+  /// @return ссылку на первый элемент в очереди
+  const_reference front() {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    if (!readable(head, 1)) {
+      throw std::invalid_argument("Error: queue is empty!");
+    }
+    return _data[head & kMask];
+  }
+
+  /// @brief Удаляет элемент с головы очереди
+  void pop() {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    if (!readable(head, 1)) {
+      throw std::invalid_argument("Error: queue is empty!");
+    }
+    alloc_traits::destroy(_alloc, _data + (head & kMask));
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  /// @brief Перемещает до n элементов из головы очереди в out и освобождает
+  /// их ячейки одной записью головы
+  /// @param out итератор вывода
+  /// @param n наибольшее число элементов
+  /// @return число извлеченных элементов
+  template <typename OutputIt>
+  size_type pop_n(OutputIt out, size_type n) {
+    const size_type head = _head.load(std::memory_order_relaxed);
+    readable(head, n);
+    n = std::min(n, _tail_cache - head);
+    size_type i = 0;
+    try {
+      for (; i < n; ++i, ++out) {
+        value_type *slot = _data + ((head + i) & kMask);
+        *out = std::move(*slot);
+        alloc_traits::destroy(_alloc, slot);
+      }
+    } catch (...) {
+      _head.store(head + i, std::memory_order_release);
+      throw;
+    }
+    _head.store(head + n, std::memory_order_release);
+    return n;
+  }
+
+  // Capacity
+  /// @brief Проверяет очередь на пустоту. Из другого потока результат
+  /// может устареть сразу после возврата
+  /// @return true, если очередь пустая
+  bool empty() const { return size() == 0; }
+
+  /// @brief Возвращает количество элементов в очереди на момент вызова
+  /// @return количество элементов в очереди
+  size_type size() const {
+    // голова читается первой: хвост не может отстать от прочитанной головы
+    const size_type head = _head.load(std::memory_order_acquire);
+    return _tail.load(std::memory_order_acquire) - head;
+  }
+
+  /// @brief Емкость очереди
+  static constexpr size_type capacity() { return Capacity; }
+
+ private:
+  using allocator_type = std::allocator<T>;
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  /// @brief Размер кэш-линии, по которому разносятся индексы
+  static constexpr size_t kCacheLineSize = 64;
+
+  static constexpr size_type kMask = Capacity - 1;
+
+  /// @brief Проверяет на стороне потребителя, что за head готово не меньше
+  /// n элементов. Хвост перечитывается, только если копии не хватает
+  bool readable(size_type head, size_type n) {
+    if (_tail_cache - head < n) {
+      _tail_cache = _tail.load(std::memory_order_acquire);
+    }
+    return _tail_cache - head >= n;
+  }
+
+  // Общие поля, только для чтения
+  allocator_type _alloc;
+  value_type *_data;
+
+  // Поля потребителя
+  alignas(kCacheLineSize) std::atomic<size_type> _head{0};
+  size_type _tail_cache = 0;
+
+  // Поля производителя
+  alignas(kCacheLineSize) std::atomic<size_type> _tail{0};
+  size_type _head_cache = 0;
+};
+
+}  // namespace rpc
+
+#endif  // RPC_SPSC_QUEUE_H
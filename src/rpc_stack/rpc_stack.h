@@ -1,100 +1,65 @@
 #ifndef RPC_STACK_H
 #define RPC_STACK_H
 
-#include <iostream>
+#include <initializer_list>
+#include <utility>
+
+#include "../rpc_vector/rpc_vector.h"
 
 namespace rpc {
 
-template <typename T>
+/// @brief Адаптер "стек" (stack) поверх контейнера с операциями back,
+/// push_back, pop_back, size и empty. Вершина стека - последний элемент
+/// контейнера. По умолчанию элементы лежат в непрерывном rpc::vector, а
+/// size() берется из контейнера за O(1).
+/// @tparam T тип элементов
+/// @tparam Container контейнер элементов, как у std::stack: например
+/// rpc::vector<T, Allocator> или rpc::list<T>. Аллокатор задается в нем
+template <typename T, typename Container = vector<T>>
 class stack {
  public:
   // внутриклассовые переопределения типов
+  using container_type = Container;
+  using allocator_type = typename Container::allocator_type;
   using value_type = T;
   using reference = T &;
   using const_reference = const T &;
   using size_type = size_t;
 
   // основные публичные методы для взаимодействия с классом
-  stack() : _top(nullptr) {}
+  stack() = default;
 
   stack(std::initializer_list<value_type> const &items) {
-    _top = nullptr;
-    for (auto i : items) push(i);
+    for (const auto &i : items) push(i);
   }
 
-  stack(const stack &s) {
-    stack_node *temp1 = s._top, *temp2;
-    _top = new stack_node(temp1->_value);
-    temp2 = _top;
-    while (temp1->_next) {
-      temp2->_next = new stack_node(temp1->_next->_value);
-      temp2 = temp2->_next;
-      temp1 = temp1->_next;
-    }
-  }
+  /// @brief Создает стек поверх готового контейнера
+  /// @param container контейнер, последний элемент которого станет вершиной
+  explicit stack(const container_type &container) : _container(container) {}
 
-  stack(stack &&s) : _top(s._top) { s._top = nullptr; }
-
-  ~stack() {
-    while (!empty()) pop();
-  }
+  stack(const stack &s) = default;
+  stack(stack &&s) = default;
+  ~stack() = default;
 
-  stack &operator=(const stack &s) {
-    if (this != &s) {
-      while (!empty()) pop();
-      stack_node *temp1 = s._top, *temp2;
-      _top = new stack_node(temp1->_value);
-      temp2 = _top;
-      while (temp1->_next) {
-        temp2->_next = new stack_node(temp1->_next->_value);
-        temp2 = temp2->_next;
-        temp1 = temp1->_next;
-      }
-    }
-    return *this;
-  }
-
-  stack &operator=(stack &&s) {
-    if (this != &s) {
-      while (!empty()) pop();
-      _top = s._top;
-      s._top = nullptr;
-    }
-    return *this;
-  }
+  stack &operator=(const stack &s) = default;
+  stack &operator=(stack &&s) = default;
 
   // публичные методы для доступа к элементам класса
-  const_reference top() { return _top->_value; }
+  const_reference top() { return _container.back(); }
 
   // публичные методы для доступа к информации о наполнении контейнера
-  bool empty() { return _top == nullptr; }
-
-  size_type size() {
-    size_type res = 0;
-    for (stack_node *temp = _top; temp; temp = temp->_next) res++;
-    return res;
-  }
+  bool empty() const { return _container.empty(); }
+  size_type size() const { return _container.size(); }
 
   // публичные методы для изменения контейнера
-  void push(const_reference value) {
-    stack_node *temp = new stack_node(value);
-    temp->_next = _top;
-    _top = temp;
-  }
+  void push(const_reference value) { _container.push_back(value); }
+  void push(value_type &&value) { _container.push_back(std::move(value)); }
 
   void pop() {
-    if (_top) {
-      stack_node *temp = _top->_next;
-      delete _top;
-      _top = temp;
-    }
+    if (!_container.empty()) _container.pop_back();
   }
 
-  void swap(stack &other) {
-    stack_node *temp = _top;
-    _top = other._top;
-    other._top = temp;
-  }
+  void swap(stack &other) { _container.swap(other._container); }
 
   // Extra
   template <typename... Args>
@@ -105,18 +70,9 @@ class stack {
   };
 
  private:
-  struct stack_node {
-    value_type _value;
-    stack_node *_next;
-
-    stack_node(value_type val) {
-      _value = val;
-      _next = nullptr;
-    }
-  };
-  stack_node *_top;
+  container_type _container;
 };
 
 }  // namespace rpc
 
-#endif
\ No newline at end of file
+#endif
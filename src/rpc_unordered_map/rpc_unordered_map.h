@@ -0,0 +1,200 @@
+#ifndef RPC_UNORDERED_MAP_H_
+#define RPC_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../rpc_hash/rpc_raw_hash_table.h"
+
+namespace rpc {
+
+/// @brief Хеш-таблица с открытой адресацией в стиле Swiss table на общей с
+/// unordered_set raw_hash_table. Элементы не перемещаются до перехеширования,
+/// поэтому итераторы и ссылки валидны до роста таблицы.
+/// @tparam Key тип ключа
+/// @tparam T тип хранимых данных
+/// @tparam Hash хеш-функция
+/// @tparam KeyEqual сравнение ключей на равенство
+/// @tparam Allocator аллокатор элементов
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map
+    : private raw_hash_table<hash_map_policy<Key, T>, Hash, KeyEqual,
+                             Allocator> {
+  using table =
+      raw_hash_table<hash_map_policy<Key, T>, Hash, KeyEqual, Allocator>;
+  template <typename K>
+  using transparent_key_t = typename table::template transparent_key_t<K>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  using iterator = hash_iterator<value_type>;
+  using const_iterator = hash_iterator<const value_type>;
+
+  /// @brief Конструктор по умолчанию, память выделяется при первой вставке
+  unordered_map() = default;
+
+  /// @brief Конструктор, сразу выделяющий память под count элементов
+  /// @param count число элементов, помещающихся без роста таблицы
+  explicit unordered_map(size_type count) { reserve(count); }
+
+  /// @brief Конструктор на базе списка инициализации
+  /// @param items список элементов
+  unordered_map(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const value_type &item : items) insert(item);
+  }
+
+  using table::bucket_count;
+  using table::clear;
+  using table::contains;
+  using table::empty;
+  using table::load_factor;
+  using table::max_size;
+  using table::reserve;
+  using table::size;
+
+  /// @brief Доступ к элементу с проверкой наличия ключа
+  /// @param key ключ
+  /// @return ссылка на хранимое значение
+  mapped_type &at(const key_type &key) {
+    return table::slot(table::checked_find(key)).second;
+  }
+  const mapped_type &at(const key_type &key) const {
+    return table::slot(table::checked_find(key)).second;
+  }
+  template <typename K, typename = transparent_key_t<K>>
+  mapped_type &at(const K &key) {
+    return table::slot(table::checked_find(key)).second;
+  }
+
+  /// @brief Доступ к элементу с вставкой значения по умолчанию, если ключа нет
+  /// @param key ключ
+  /// @return ссылка на хранимое значение
+  mapped_type &operator[](const key_type &key) {
+    return table::slot(table::emplace_key(key).first).second;
+  }
+  mapped_type &operator[](key_type &&key) {
+    return table::slot(table::emplace_key(std::move(key)).first).second;
+  }
+
+  iterator begin() { return table::template first<value_type>(); }
+  iterator end() { return iterator_at(bucket_count()); }
+  const_iterator begin() const {
+    return table::template first<const value_type>();
+  }
+  const_iterator end() const { return iterator_at(bucket_count()); }
+
+  /// @brief Вставляет элемент, если ключа ещё нет
+  /// @param value элемент
+  /// @return итератор на элемент с этим ключом и признак вставки
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return to_iterator(table::emplace_key(value.first, value.second));
+  }
+
+  /// @brief Вставляет значение по ключу, если ключа ещё нет
+  /// @param key ключ
+  /// @param obj значение
+  /// @return итератор на элемент с этим ключом и признак вставки
+  std::pair<iterator, bool> insert(const key_type &key,
+                                   const mapped_type &obj) {
+    return to_iterator(table::emplace_key(key, obj));
+  }
+
+  /// @brief Вставляет элемент или присваивает значение существующему
+  /// @param key ключ
+  /// @param obj значение
+  /// @return итератор на элемент с этим ключом и признак вставки
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+    std::pair<size_type, bool> dest = table::emplace_key(key, obj);
+    if (!dest.second) table::slot(dest.first).second = obj;
+    return to_iterator(dest);
+  }
+
+  /// @brief Создаёт элемент из аргументов конструктора value_type
+  /// @param args аргументы конструктора value_type
+  /// @return итератор на элемент с этим ключом и признак вставки
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    return to_iterator(
+        table::emplace_key(value.first, std::move(value.second)));
+  }
+
+  /// @brief Удаляет элемент в указанной позиции
+  /// @param pos позиция элемента
+  void erase(iterator pos) {
+    if (pos != end()) table::erase_index(table::index_of(pos));
+  }
+
+  /// @brief Удаляет элемент по ключу
+  /// @param key ключ
+  /// @return количество удалённых элементов: 0 или 1
+  size_type erase(const key_type &key) { return table::erase(key); }
+
+  void swap(unordered_map &other) noexcept { table::swap(other); }
+
+  /// @brief Переносит из other элементы с ключами, которых нет в текущей
+  /// таблице. Остальные элементы остаются в other
+  /// @param other таблица для объединения
+  void merge(unordered_map &other) { table::merge(other); }
+
+  /// @brief Поиск элемента по ключу
+  /// @param key ключ
+  /// @return итератор на элемент или end()
+  iterator find(const key_type &key) {
+    return iterator_at(table::find_index(key));
+  }
+  const_iterator find(const key_type &key) const {
+    return iterator_at(table::find_index(key));
+  }
+  template <typename K, typename = transparent_key_t<K>>
+  iterator find(const K &key) {
+    return iterator_at(table::find_index(key));
+  }
+  template <typename K, typename = transparent_key_t<K>>
+  const_iterator find(const K &key) const {
+    return iterator_at(table::find_index(key));
+  }
+
+  /// @brief Вставляет несколько элементов. Память резервируется заранее,
+  /// поэтому все возвращённые итераторы валидны
+  /// @param args элементы
+  /// @return итераторы и признаки вставки в порядке аргументов
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> vec;
+    vec.reserve(sizeof...(args));
+    reserve(size() + sizeof...(args));
+    (vec.push_back(insert(value_type(std::forward<Args>(args)))), ...);
+    return vec;
+  }
+
+ private:
+  iterator iterator_at(size_type index) {
+    return table::template iterator_at<value_type>(index);
+  }
+  const_iterator iterator_at(size_type index) const {
+    return table::template iterator_at<const value_type>(index);
+  }
+  std::pair<iterator, bool> to_iterator(std::pair<size_type, bool> dest) {
+    return {iterator_at(dest.first), dest.second};
+  }
+};
+
+}  // namespace rpc
+
+#endif  // RPC_UNORDERED_MAP_H_
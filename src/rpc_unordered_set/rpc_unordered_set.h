@@ -0,0 +1,133 @@
+#ifndef RPC_UNORDERED_SET_H_
+#define RPC_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../rpc_hash/rpc_raw_hash_table.h"
+
+namespace rpc {
+
+/// @brief Множество на хеш-таблице с открытой адресацией, общей с
+/// unordered_map (raw_hash_table): плоский массив ключей и массив управляющих
+/// байт, которые при поиске сравниваются целой группой (SSE2/AVX2, см.
+/// hash_group). Ключи не перемещаются до перехеширования.
+/// @tparam Key тип ключа
+/// @tparam Hash хеш-функция
+/// @tparam KeyEqual сравнение ключей на равенство
+/// @tparam Allocator аллокатор ключей
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>,
+          typename Allocator = std::allocator<Key>>
+class unordered_set
+    : private raw_hash_table<hash_set_policy<Key>, Hash, KeyEqual, Allocator> {
+  using table = raw_hash_table<hash_set_policy<Key>, Hash, KeyEqual, Allocator>;
+  template <typename K>
+  using transparent_key_t = typename table::template transparent_key_t<K>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using allocator_type = Allocator;
+  /// @brief Ключи менять нельзя, поэтому iterator и const_iterator совпадают
+  using iterator = hash_iterator<const Key>;
+  using const_iterator = iterator;
+
+  /// @brief Конструктор по умолчанию, память выделяется при первой вставке
+  unordered_set() = default;
+
+  /// @brief Конструктор, сразу выделяющий память под count элементов
+  /// @param count число элементов, помещающихся без роста таблицы
+  explicit unordered_set(size_type count) { reserve(count); }
+
+  /// @brief Конструктор на базе списка инициализации
+  /// @param items список элементов
+  unordered_set(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const value_type &item : items) insert(item);
+  }
+
+  using table::bucket_count;
+  using table::clear;
+  using table::contains;
+  using table::empty;
+  using table::load_factor;
+  using table::max_size;
+  using table::reserve;
+  using table::size;
+
+  iterator begin() const { return table::template first<const Key>(); }
+  iterator end() const { return iterator_at(bucket_count()); }
+
+  /// @brief Вставляет ключ, если его ещё нет
+  /// @param value ключ
+  /// @return итератор на элемент с этим ключом и признак вставки
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return to_iterator(table::emplace_key(value));
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return to_iterator(table::emplace_key(std::move(value)));
+  }
+
+  /// @brief Удаляет элемент в указанной позиции
+  /// @param pos позиция элемента
+  void erase(iterator pos) {
+    if (pos != end()) table::erase_index(table::index_of(pos));
+  }
+
+  /// @brief Удаляет ключ
+  /// @param key ключ
+  /// @return количество удалённых элементов: 0 или 1
+  size_type erase(const key_type &key) { return table::erase(key); }
+
+  void swap(unordered_set &other) noexcept { table::swap(other); }
+
+  /// @brief Переносит из other ключи, которых нет в текущем множестве.
+  /// Остальные ключи остаются в other
+  /// @param other множество для объединения
+  void merge(unordered_set &other) { table::merge(other); }
+
+  /// @brief Поиск ключа
+  /// @param key ключ
+  /// @return итератор на элемент или end()
+  iterator find(const key_type &key) const {
+    return iterator_at(table::find_index(key));
+  }
+  template <typename K, typename = transparent_key_t<K>>
+  iterator find(const K &key) const {
+    return iterator_at(table::find_index(key));
+  }
+
+  /// @brief Вставляет несколько ключей. Память резервируется заранее,
+  /// поэтому все возвращённые итераторы валидны
+  /// @param args ключи
+  /// @return итераторы и признаки вставки в порядке аргументов
+  template <typename... Args>
+  std::vector<std::pair<iterator, bool>> insert_many(Args &&...args) {
+    std::vector<std::pair<iterator, bool>> vec;
+    vec.reserve(sizeof...(args));
+    reserve(size() + sizeof...(args));
+    (vec.push_back(insert(value_type(std::forward<Args>(args)))), ...);
+    return vec;
+  }
+
+ private:
+  iterator iterator_at(size_type index) const {
+    return table::template iterator_at<const Key>(index);
+  }
+  std::pair<iterator, bool> to_iterator(std::pair<size_type, bool> dest) {
+    return {iterator_at(dest.first), dest.second};
+  }
+};
+
+}  // namespace rpc
+
+#endif  // RPC_UNORDERED_SET_H_
@@ -0,0 +1,460 @@
+#ifndef RPC_UNROLLED_LIST_H
+#define RPC_UNROLLED_LIST_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "../rpc_allocator/rpc_allocator.h"
+#include "../rpc_list/rpc_list.h"
+
+namespace rpc {
+
+/// @brief Развернутый двусвязный список: узел (блок) хранит до BlockSize
+/// элементов подряд и их число. Обход идет по непрерывным массивам, поэтому
+/// на элемент приходится не один промах кеша, а 1/BlockSize. Блоки связаны в
+/// кольцо со сторожевым блоком через list_hook и list_ring, как узлы
+/// rpc::list. Пустых блоков нет: опустевший блок освобождается, а соседние
+/// блоки, вместе занятые не больше чем наполовину, при удалении сливаются.
+///
+/// Отличия от rpc::list: insert и erase сдвигают элементы внутри блока и
+/// делают недействительными итераторы и ссылки на элементы этого блока (и
+/// соседнего, если блоки разделились или слились). splice всего списка
+/// перевешивает блоки за O(1), splice одного элемента и диапазона переносит
+/// значения перемещением.
+/// @tparam T тип элементов
+/// @tparam BlockSize число элементов в блоке, по умолчанию блок ~512 байт
+/// @tparam Allocator аллокатор, перепривязывается на тип блока
+template <typename T, size_t BlockSize = (sizeof(T) < 512 ? 512 / sizeof(T)
+                                                           : 1),
+          typename Allocator = pool_allocator<T>>
+class unrolled_list {
+  static_assert(BlockSize > 0, "BlockSize must be positive");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+ protected:
+  // Заголовок блока; сторожевой блок - только заголовок с data_ == nullptr
+  struct BlockBase : list_hook {
+    value_type* data_;
+    size_type count_;
+    BlockBase() : data_(nullptr), count_(0) {}
+  };
+  struct Block : BlockBase {
+    alignas(value_type) unsigned char storage_[BlockSize * sizeof(value_type)];
+    Block() { this->data_ = reinterpret_cast<value_type*>(storage_); }
+  };
+  using block_allocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+
+  BlockBase sentinel_;
+  size_t size_;
+  block_allocator alloc_;
+
+  static BlockBase* as_block(list_hook* node) {
+    return static_cast<BlockBase*>(node);
+  }
+
+  // Итератор хранит блок и текущий элемент с концом его массива: ++ - это
+  // инкремент указателя, к следующему блоку переходит только на границе.
+  // У end() блок - сторожевой, cur_ == end_ == nullptr
+  class UnrolledIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
+    UnrolledIterator() : block_(nullptr), cur_(nullptr), end_(nullptr) {}
+    reference operator*() const { return *cur_; }
+    pointer operator->() const { return cur_; }
+
+    UnrolledIterator operator++(int) {
+      UnrolledIterator it(*this);
+      ++*this;
+      return it;
+    }
+    UnrolledIterator operator--(int) {
+      UnrolledIterator it(*this);
+      --*this;
+      return it;
+    }
+    UnrolledIterator& operator++() {
+      if (++cur_ == end_) *this = UnrolledIterator(as_block(block_->next_), 0);
+      return *this;
+    }
+    UnrolledIterator& operator--() {
+      if (cur_ == block_->data_) {
+        BlockBase* prev = as_block(block_->prev_);
+        *this = UnrolledIterator(prev, prev->count_);
+      }
+      --cur_;
+      return *this;
+    }
+    friend bool operator==(const UnrolledIterator& a,
+                           const UnrolledIterator& b) {
+      return a.cur_ == b.cur_;
+    }
+    friend bool operator!=(const UnrolledIterator& a,
+                           const UnrolledIterator& b) {
+      return a.cur_ != b.cur_;
+    }
+
+   private:
+    BlockBase* block_;
+    value_type* cur_;
+    value_type* end_;
+    friend class unrolled_list;
+
+    UnrolledIterator(BlockBase* block, size_type index)
+        : block_(block),
+          cur_(block->data_ + index),
+          end_(block->data_ + block->count_) {}
+  };
+
+  class UnrolledConstIterator {
+   public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
+    UnrolledConstIterator() : it_() {}
+    UnrolledConstIterator(const UnrolledIterator& other) : it_(other) {}
+    reference operator*() const { return *it_; }
+    pointer operator->() const { return it_.cur_; }
+
+    UnrolledConstIterator operator++(int) { return it_++; }
+    UnrolledConstIterator operator--(int) { return it_--; }
+    UnrolledConstIterator& operator++() {
+      ++it_;
+      return *this;
+    }
+    UnrolledConstIterator& operator--() {
+      --it_;
+      return *this;
+    }
+    friend bool operator==(const UnrolledConstIterator& a,
+                           const UnrolledConstIterator& b) {
+      return a.it_ == b.it_;
+    }
+    friend bool operator!=(const UnrolledConstIterator& a,
+                           const UnrolledConstIterator& b) {
+      return a.it_ != b.it_;
+    }
+
+   private:
+    UnrolledIterator it_;
+    friend class unrolled_list;
+  };
+
+  BlockBase* sentinel() const { return const_cast<BlockBase*>(&sentinel_); }
+
+  static size_type index_of(const UnrolledIterator& it) {
+    return it.cur_ - it.block_->data_;
+  }
+
+  void reset() {
+    list_ring::reset(&sentinel_);
+    size_ = 0;
+  }
+
+  // Новый пустой блок перед at
+  BlockBase* new_block_before(BlockBase* at) {
+    Block* block = create_node<Block>(alloc_);
+    list_ring::link_before(at, block, block);
+    return block;
+  }
+
+  void free_block(BlockBase* block) {
+    list_ring::unlink(block, block);
+    destroy_node(alloc_, static_cast<Block*>(block));
+  }
+
+  // Переносит элементы from[index, count_) в конец to
+  static void move_tail(BlockBase* from, size_type index, BlockBase* to) {
+    value_type* dest = to->data_ + to->count_;
+    for (size_type i = index; i < from->count_; ++i, ++to->count_, ++dest) {
+      ::new (static_cast<void*>(dest)) value_type(std::move(from->data_[i]));
+    }
+    std::destroy(from->data_ + index, from->data_ + from->count_);
+    from->count_ = index;
+  }
+
+  // Делит блок: элементы с index переносятся в новый блок сразу за ним
+  BlockBase* split(BlockBase* block, size_type index) {
+    BlockBase* tail = new_block_before(as_block(block->next_));
+    move_tail(block, index, tail);
+    return tail;
+  }
+
+  // Блок и позиция в нем для вставки перед pos. Вставка в конец списка
+  // дописывает последний блок или открывает новый, полный блок делится
+  // пополам
+  std::pair<BlockBase*, size_type> make_room(UnrolledIterator pos) {
+    BlockBase* block = pos.block_;
+    size_type index = index_of(pos);
+    if (block == &sentinel_) {
+      block = as_block(sentinel_.prev_);
+      if (block == &sentinel_ || block->count_ == BlockSize)
+        return {new_block_before(&sentinel_), 0};
+      return {block, block->count_};
+    }
+    if (block->count_ < BlockSize) return {block, index};
+    const size_type half = BlockSize / 2;
+    if (half == 0) return {new_block_before(block), 0};
+    BlockBase* tail = split(block, half);
+    if (index <= half) return {block, index};
+    return {tail, index - half};
+  }
+
+  // Удаляет элемент; пустой блок освобождается, а недогруженный сливается с
+  // соседним. Возвращает итератор на следующий элемент
+  UnrolledIterator erase_at(BlockBase* block, size_type index) {
+    value_type* data = block->data_;
+    std::move(data + index + 1, data + block->count_, data + index);
+    std::destroy_at(data + --block->count_);
+    --size_;
+    BlockBase* next = as_block(block->next_);
+    if (block->count_ == 0) {
+      free_block(block);
+      return UnrolledIterator(next, 0);
+    }
+    BlockBase* prev = as_block(block->prev_);
+    if (next != &sentinel_ && block->count_ + next->count_ <= BlockSize / 2) {
+      move_tail(next, 0, block);
+      free_block(next);
+    } else if (prev != &sentinel_ &&
+               prev->count_ + block->count_ <= BlockSize / 2) {
+      index += prev->count_;
+      move_tail(block, 0, prev);
+      free_block(block);
+      block = prev;
+    }
+    if (index < block->count_) return UnrolledIterator(block, index);
+    return UnrolledIterator(as_block(block->next_), 0);
+  }
+
+  static UnrolledIterator mutable_iterator(UnrolledConstIterator it) {
+    return it.it_;
+  }
+
+ public:
+  using iterator = UnrolledIterator;
+  using const_iterator = UnrolledConstIterator;
+
+  unrolled_list() : size_(0) {}
+
+  unrolled_list(size_type n) : size_(0) {
+    for (size_t i = 0; i < n; ++i) push_back(value_type());
+  }
+
+  unrolled_list(std::initializer_list<value_type> const& items) : size_(0) {
+    for (const_reference value : items) push_back(value);
+  }
+
+  unrolled_list(const unrolled_list& other) : size_(0) {
+    for (const_reference value : other) push_back(value);
+  }
+
+  // блоки перевешиваются на sentinel_ нового объекта
+  unrolled_list(unrolled_list&& other) : size_(0) { splice(cend(), other); }
+
+  ~unrolled_list() { clear(); }
+
+  unrolled_list& operator=(const unrolled_list& other) {
+    if (this != &other) {
+      clear();
+      for (const_reference value : other) push_back(value);
+    }
+    return *this;
+  }
+
+  unrolled_list& operator=(unrolled_list&& other) {
+    if (this != &other) {
+      clear();
+      splice(cend(), other);
+    }
+    return *this;
+  }
+
+  const_reference front() const { return *begin(); }
+  const_reference back() const { return *--end(); }
+
+  iterator begin() { return iterator(as_block(sentinel_.next_), 0); }
+  iterator end() { return iterator(&sentinel_, 0); }
+  const_iterator begin() const {
+    return iterator(as_block(sentinel_.next_), 0);
+  }
+  const_iterator end() const { return iterator(sentinel(), 0); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  void clear() {
+    list_hook* node = sentinel_.next_;
+    while (node != &sentinel_) {
+      BlockBase* block = as_block(node);
+      node = node->next_;
+      std::destroy(block->data_, block->data_ + block->count_);
+      destroy_node(alloc_, static_cast<Block*>(block));
+    }
+    reset();
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type&& value) {
+    return emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    if (pos.it_.block_ == nullptr)
+      throw std::logic_error("Passed an empty iterator");
+    if (pos.it_.block_ == &sentinel_) {
+      // вставка в конец не сдвигает элементов: args остаются валидными
+      auto [block, index] = make_room(pos.it_);
+      ::new (static_cast<void*>(block->data_ + index))
+          value_type(std::forward<Args>(args)...);
+      ++block->count_;
+      ++size_;
+      return iterator(block, index);
+    }
+    // make_room переносит элементы, поэтому значение создается до него: args
+    // может ссылаться на элемент самого списка
+    value_type value(std::forward<Args>(args)...);
+    auto [block, index] = make_room(pos.it_);
+    value_type* data = block->data_;
+    ::new (static_cast<void*>(data + block->count_))
+        value_type(std::move(value));
+    ++block->count_;
+    std::rotate(data + index, data + block->count_ - 1, data + block->count_);
+    ++size_;
+    return iterator(block, index);
+  }
+
+  /// @return итератор на элемент, следующий за удаленным
+  iterator erase(const_iterator pos) {
+    if (pos.it_.block_ == nullptr || pos.it_.block_ == &sentinel_)
+      throw std::logic_error("Passed an empty iterator");
+    return erase_at(pos.it_.block_, index_of(pos.it_));
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type count = std::distance(first, last);
+    iterator it = mutable_iterator(first);
+    while (count-- > 0) it = erase(it);
+    return it;
+  }
+
+  void push_back(const_reference value) { emplace(cend(), value); }
+  void push_back(value_type&& value) { emplace(cend(), std::move(value)); }
+
+  void pop_back() {
+    if (size_ > 0) erase(--end());
+  }
+
+  void push_front(const_reference value) { emplace(cbegin(), value); }
+  void push_front(value_type&& value) { emplace(cbegin(), std::move(value)); }
+
+  void pop_front() {
+    if (size_ > 0) erase(begin());
+  }
+
+  void swap(unrolled_list& other) {
+    if (this == &other) return;
+    unrolled_list tmp(std::move(other));
+    other.splice(other.cend(), *this);
+    splice(cend(), tmp);
+  }
+
+  // Splice всего списка: блоки other перевешиваются за O(1) без переноса
+  // элементов; если pos в середине блока, блок сначала делится
+  void splice(const_iterator pos, unrolled_list& other) {
+    if (this == &other || other.empty()) return;
+    BlockBase* at = pos.it_.block_;
+    size_type index = index_of(pos.it_);
+    if (index > 0) at = split(at, index);
+    list_ring::link_before(at, other.sentinel_.next_, other.sentinel_.prev_);
+    size_ += other.size_;
+    other.reset();
+  }
+
+  void splice(const_iterator pos, unrolled_list&& other) {
+    splice(pos, other);
+  }
+
+  void splice(const_iterator pos, unrolled_list& other, const_iterator it) {
+    if (it.it_.block_ == nullptr || it.it_.block_ == &other.sentinel_)
+      throw std::logic_error("Passed an empty iterator");
+    const_iterator next = it;
+    splice(pos, other, it, ++next);
+  }
+
+  void splice(const_iterator pos, unrolled_list&& other, const_iterator it) {
+    splice(pos, other, it);
+  }
+
+  // Splice диапазона переносит значения перемещением; внутри одного списка
+  // это поворот элементов
+  void splice(const_iterator pos, unrolled_list& other, const_iterator first,
+              const_iterator last) {
+    if (first == last) return;
+    if (this == &other) {
+      if (pos == first || pos == last) return;
+      bool after = false;
+      for (const_iterator it = last;; ++it) {
+        if (it == pos) after = true;
+        if (after || it == cend()) break;
+      }
+      if (after) {
+        std::rotate(mutable_iterator(first), mutable_iterator(last),
+                    mutable_iterator(pos));
+      } else {
+        std::rotate(mutable_iterator(pos), mutable_iterator(first),
+                    mutable_iterator(last));
+      }
+      return;
+    }
+    iterator at = mutable_iterator(pos);
+    for (const_iterator it = first; it != last; ++it) {
+      at = emplace(at, std::move(*mutable_iterator(it)));
+      ++at;
+    }
+    other.erase(first, last);
+  }
+
+  void splice(const_iterator pos, unrolled_list&& other, const_iterator first,
+              const_iterator last) {
+    splice(pos, other, first, last);
+  }
+
+  /// @brief Число блоков: для оценки заполнения
+  size_type block_count() const {
+    return list_ring::count(sentinel_.next_, sentinel());
+  }
+};
+
+}  // namespace rpc
+
+#endif  // RPC_UNROLLED_LIST_H
@@ -5,8 +5,8 @@
 
 namespace rpc {
 
-template <typename value_type>
-class vector<value_type>::VectorIterator {
+template <typename value_type, typename Allocator, typename Growth>
+class vector<value_type, Allocator, Growth>::VectorIterator {
  public:
   VectorIterator() = default;
   VectorIterator(iterator ptr);
@@ -26,8 +26,9 @@ class vector<value_type>::VectorIterator {
   iterator ptr_;
 };  // class VectorIterator
 
-template <typename value_type>
-class vector<value_type>::VectorConstIterator : public VectorIterator {
+template <typename value_type, typename Allocator, typename Growth>
+class vector<value_type, Allocator, Growth>::VectorConstIterator
+    : public VectorIterator {
  public:
   VectorConstIterator() = default;
   VectorConstIterator(const_iterator ptr);
@@ -51,150 +52,155 @@ class vector<value_type>::VectorConstIterator : public VectorIterator {
 // Implementations
 //
 // VectorIterator
-template <typename value_type>
-vector<value_type>::VectorIterator::VectorIterator(iterator ptr) : ptr_(ptr) {}
+template <typename value_type, typename Allocator, typename Growth>
+vector<value_type, Allocator, Growth>::VectorIterator::VectorIterator(
+    iterator ptr)
+    : ptr_(ptr) {}
 
-template <typename value_type>
-typename vector<value_type>::reference
-vector<value_type>::VectorIterator::operator*() {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::reference
+vector<value_type, Allocator, Growth>::VectorIterator::operator*() {
   return *ptr_;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorIterator&
-vector<value_type>::VectorIterator::operator++() {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorIterator&
+vector<value_type, Allocator, Growth>::VectorIterator::operator++() {
   ++ptr_;
   return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorIterator&
-vector<value_type>::VectorIterator::operator--() {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorIterator&
+vector<value_type, Allocator, Growth>::VectorIterator::operator--() {
   --ptr_;
   return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorIterator
-vector<value_type>::VectorIterator::operator++(int) {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorIterator
+vector<value_type, Allocator, Growth>::VectorIterator::operator++(int) {
   VectorIterator temp(*this);
   ++ptr_;
   return temp;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorIterator
-vector<value_type>::VectorIterator::operator--(int) {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorIterator
+vector<value_type, Allocator, Growth>::VectorIterator::operator--(int) {
   VectorIterator temp(*this);
   --ptr_;
   return temp;
 }
 
-template <typename value_type>
-bool vector<value_type>::VectorIterator::operator==(
+template <typename value_type, typename Allocator, typename Growth>
+bool vector<value_type, Allocator, Growth>::VectorIterator::operator==(
     const VectorIterator& other) const {
   return ptr_ == other.ptr_;
 }
 
-template <typename value_type>
-bool vector<value_type>::VectorIterator::operator!=(
+template <typename value_type, typename Allocator, typename Growth>
+bool vector<value_type, Allocator, Growth>::VectorIterator::operator!=(
     const VectorIterator& other) const {
   return ptr_ != other.ptr_;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorIterator
-vector<value_type>::VectorIterator::operator+(int n) const {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorIterator
+vector<value_type, Allocator, Growth>::VectorIterator::operator+(int n) const {
   VectorIterator temp = *this;
   for (int i = 0; i < n; i++) temp++;
   return temp;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorIterator
-vector<value_type>::VectorIterator::operator-(int n) const {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorIterator
+vector<value_type, Allocator, Growth>::VectorIterator::operator-(int n) const {
   VectorIterator temp = *this;
   for (int i = 0; i < n; i++) temp--;
   return temp;
 }
 
-template <typename value_type>
-ptrdiff_t vector<value_type>::VectorIterator::operator-(
+template <typename value_type, typename Allocator, typename Growth>
+ptrdiff_t vector<value_type, Allocator, Growth>::VectorIterator::operator-(
     const VectorIterator& other) const {
   return ptr_ - other.ptr_;
 }
 
 // VectorConstIterator
-template <typename value_type>
-vector<value_type>::VectorConstIterator::VectorConstIterator(const_iterator ptr)
+template <typename value_type, typename Allocator, typename Growth>
+vector<value_type, Allocator, Growth>::VectorConstIterator::VectorConstIterator(
+    const_iterator ptr)
     : ptr_(ptr) {}
 
-template <typename value_type>
-typename vector<value_type>::const_reference
-vector<value_type>::VectorConstIterator::operator*() const {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::const_reference
+vector<value_type, Allocator, Growth>::VectorConstIterator::operator*() const {
   return *ptr_;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorConstIterator&
-vector<value_type>::VectorConstIterator::operator++() {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorConstIterator&
+vector<value_type, Allocator, Growth>::VectorConstIterator::operator++() {
   ++ptr_;
   return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorConstIterator&
-vector<value_type>::VectorConstIterator::operator--() {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorConstIterator&
+vector<value_type, Allocator, Growth>::VectorConstIterator::operator--() {
   --ptr_;
   return *this;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorConstIterator
-vector<value_type>::VectorConstIterator::operator++(int) {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorConstIterator
+vector<value_type, Allocator, Growth>::VectorConstIterator::operator++(int) {
   VectorConstIterator temp(*this);
   ++ptr_;
   return temp;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorConstIterator
-vector<value_type>::VectorConstIterator::operator--(int) {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorConstIterator
+vector<value_type, Allocator, Growth>::VectorConstIterator::operator--(int) {
   VectorConstIterator temp(*this);
   --ptr_;
   return temp;
 }
 
-template <typename value_type>
-bool vector<value_type>::VectorConstIterator::operator==(
+template <typename value_type, typename Allocator, typename Growth>
+bool vector<value_type, Allocator, Growth>::VectorConstIterator::operator==(
     const VectorConstIterator& other) const {
   return ptr_ == other.ptr_;
 }
 
-template <typename value_type>
-bool vector<value_type>::VectorConstIterator::operator!=(
+template <typename value_type, typename Allocator, typename Growth>
+bool vector<value_type, Allocator, Growth>::VectorConstIterator::operator!=(
     const VectorConstIterator& other) const {
   return ptr_ != other.ptr_;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorConstIterator
-vector<value_type>::VectorConstIterator::operator+(int n) const {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorConstIterator
+vector<value_type, Allocator, Growth>::VectorConstIterator::operator+(
+    int n) const {
   VectorConstIterator temp = *this;
   for (int i = 0; i < n; i++) temp++;
   return temp;
 }
 
-template <typename value_type>
-typename vector<value_type>::VectorConstIterator
-vector<value_type>::VectorConstIterator::operator-(int n) const {
+template <typename value_type, typename Allocator, typename Growth>
+typename vector<value_type, Allocator, Growth>::VectorConstIterator
+vector<value_type, Allocator, Growth>::VectorConstIterator::operator-(
+    int n) const {
   VectorConstIterator temp = *this;
   for (int i = 0; i < n; i++) temp--;
   return temp;
 }
 
-template <typename value_type>
-ptrdiff_t vector<value_type>::VectorConstIterator::operator-(
+template <typename value_type, typename Allocator, typename Growth>
+ptrdiff_t vector<value_type, Allocator, Growth>::VectorConstIterator::operator-(
     const VectorConstIterator& other) const {
   return ptr_ - other.ptr_;
 };  // class VectorConstIterator
@@ -1,16 +1,31 @@
 #ifndef RPC_VECTOR_H
 #define RPC_VECTOR_H
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "rpc_vector_base.h"
 
 namespace rpc {
 
 /// @brief Шаблонный класс для контейнера "вектор" (vector)
 /// @tparam T - тип элементов, содержащихся в контейнере
-template <typename T>
-class vector {
+/// @tparam Allocator - аллокатор хранилища элементов
+/// @tparam GrowthPolicy - правило роста емкости при нехватке места:
+/// geometric_growth (growth_2x, growth_1_5x) или fixed_growth
+template <typename T, typename Allocator = std::allocator<T>,
+          typename GrowthPolicy = growth_2x>
+class vector : public vector_base<T, Allocator, GrowthPolicy, 0> {
+  /// @brief Хранилище, доступ к элементам, вставка и удаление
+  using base = vector_base<T, Allocator, GrowthPolicy, 0>;
+
  public:
   // Классы итераторов
   /// @brief Класс константного итератора по вектору
@@ -19,7 +34,8 @@ class vector {
   /// @brief Класс итератора по вектору
   class VectorIterator;
 
-  // Vector Member type
+  // Vector Member type. Повторяют типы vector_base: по ним rpc_iterators.h
+  // определяет итераторы вне класса
   /// @brief Тип элемента, хранящегося в контейнере
   using value_type = T;
 
@@ -38,290 +54,168 @@ class vector {
   /// @brief Тип размера контейнера (стандартный тип size_t)
   using size_type = size_t;
 
-  // Fields
-  /// @brief Указатель, хранящий положение первого элемента данных
-  value_type *_data;
+  /// @brief Тип аллокатора
+  using allocator_type = Allocator;
 
-  /// @brief Количество элементов, хранимых в векторе
-  size_type _size;
+  /// @brief Правило роста емкости
+  using growth_policy = GrowthPolicy;
 
-  /// @brief Полный объем памяти, выделенный под данные
-  size_type _capacity;
+ private:
+  using typename base::alloc_traits;
+  template <typename It>
+  using input_iterator_t = typename base::template input_iterator_t<It>;
+  using base::allocate;
+  using base::construct_range;
+  using base::kBitwise;
+  using base::replace_storage;
+  using base::_stats;
+
+ public:
+  // Fields
+  using base::_alloc;
+  using base::_capacity;
+  using base::_data;
+  using base::_size;
 
   // Member functions
   /// @brief Конструктор по умолчанию, создаёт пустой вектор
-  vector() noexcept : _data(nullptr), _size(0), _capacity(0) {};
+  vector() noexcept {}
 
   /// @brief Конструктор с параметром, создает вектор заданной длины
   /// @param n заданная длина вектора
-  vector(size_type n) : _data(new value_type[n]), _size(n), _capacity(n) {
-    std::fill_n(_data, n, value_type());
-  };
+  vector(size_type n) {
+    _data = allocate(n);
+    _capacity = n;
+    try {
+      for (; _size < n; ++_size) alloc_traits::construct(_alloc, _data + _size);
+    } catch (...) {
+      this->release_all();
+      throw;
+    }
+  }
 
   /// @brief Конструктор с параметром, создает вектор, инициализированный
   /// списком std::initializer_list
   /// @param items список, переданный для инициализации вектора
-  vector(std::initializer_list<value_type> const &items)
-      : _data(new value_type[items.size()]),
-        _size(items.size()),
-        _capacity(items.size()) {
-    size_type k = 0;
+  vector(std::initializer_list<value_type> const &items) {
+    _data = allocate(items.size());
+    _capacity = items.size();
     try {
-      for (const auto &elem : items) {
-        new (_data + k) value_type(elem);
-        k++;
-      }
+      // construct_range сам разрушает созданные элементы при исключении
+      construct_range(items.begin(), items.size(), _data);
     } catch (...) {
-      for (size_type i = 0; i < k; ++i) {
-        delete (_data + i);
-      }
-      delete[] _data;
+      this->release();
       throw std::invalid_argument("Error: failed to create vector from list");
     }
-  };
+    _size = items.size();
+  }
+
+  /// @brief Конструктор из диапазона [first, last): для прямых итераторов
+  /// память выделяется один раз под точное число элементов
+  /// @param first итератор на первый элемент
+  /// @param last итератор за последним элементом
+  template <typename InputIt, typename = input_iterator_t<InputIt>>
+  vector(InputIt first, InputIt last) {
+    try {
+      this->insert(this->cend(), first, last);
+    } catch (...) {
+      this->release_all();
+      throw;
+    }
+  }
+
+  /// @brief Конструктор из любого диапазона с begin() и end()
+  /// @param range диапазон, например std::vector или массив
+  template <typename Range>
+  vector(from_range_t, Range &&range)
+      : vector(std::begin(range), std::end(range)) {}
 
   /// @brief Конструктор копирования
   /// @param v объект-вектор для копирования содержимого в создаваемый объект
   vector(const vector &v)
-      : _data(new value_type[v.size()]), _size(v.size()), _capacity(v.size()) {
+      : base(alloc_traits::select_on_container_copy_construction(v._alloc)) {
+    _data = allocate(v._size);
+    _capacity = v._size;
     try {
-      for (size_type i = 0; i < _size; ++i) {
-        new (_data + i) value_type();
-      }
-      for (size_type i = 0; i < _size; ++i) {
-        _data[i] = v._data[i];
-      }
+      construct_range(v._data, v._size, _data);
     } catch (...) {
-      for (size_type i = 0; i < _size; ++i) {
-        delete (_data + i);
-      }
-      delete[] _data;
+      this->release();
       throw std::invalid_argument("Error: failed to copy vector");
     }
-  };
+    _size = v._size;
+  }
 
   /// @brief Конструктор перемещения
   /// @param v объект-вектор для инициализации создаваемого объекта
-  vector(vector &&v) noexcept
-      : _data(v._data), _size(v._size), _capacity(v._capacity) {
-    v._data = nullptr;
-    v._size = 0;
-    v._capacity = 0;
-  };
+  vector(vector &&v) noexcept : base(std::move(v._alloc)) { steal(v); }
 
   /// @brief Деструктор класса
-  ~vector() {
-    delete[] _data;
-    _size = 0;
-    _capacity = 0;
-    _data = nullptr;
-  };
+  ~vector() { this->release_all(); }
 
   /// @brief Перегрузка оператора присваивания
   /// @param v объект-вектор - источник значений для присваивания
-  vector operator=(vector &v) {
-    if (this != &v) {
-      if (_data) delete[] _data;
-      _data = new value_type[v._capacity];
-      _capacity = v._capacity;
-      _size = v._size;
-      std::copy(v._data, v._data + v._size, _data);
-    }
-    return *this;
-  };
-
-  // Element access
-  /// @brief Осуществляет доступ к элементу по его номеру, с проверкой границ
-  /// @param pos позиция элемента вектора
-  /// @return ссылку на элемент вектора
-  reference at(size_type pos) {
-    if (pos >= _size) {
-      throw std::out_of_range("Error: index out of range");
-    }
-    return _data[pos];
-  };
-
-  /// @brief Реализует оператор [] - доступ к элементу по номеру
-  /// @param pos номер элемента в векторе
-  /// @return ссылку на элемент вектора
-  reference operator[](size_type pos) { return this->at(pos); };
-
-  /// @brief Реализует константный оператор [] - доступ к элементу по номеру
-  /// @param pos номер элемента в векторе
-  /// @return константную ссылку на элемент вектора
-  const reference operator[](size_t pos) const { return this->at(pos); };
-
-  /// @brief Осуществляет доступ к первому элементу вектора
-  /// @return константную ссылку на первый элемент вектора
-  const_reference front() {
-    if (!_size) {
-      throw std::out_of_range("Error: vector is empty");
+  vector &operator=(const vector &v) {
+    if (this == &v) return *this;
+    if constexpr (kBitwise) {
+      // побайтное копирование не бросает: хранилище можно переиспользовать
+      if (v._size <= _capacity) {
+        construct_range(v._data, v._size, _data);
+        _size = v._size;
+        return *this;
+      }
     }
-    return _data[0];
-  };
-
-  /// @brief Осуществляет доступ к последнему элементу вектора
-  /// @return константную ссылку на последний элемент вектора
-  const_reference back() {
-    if (!_size) {
-      throw std::out_of_range("Error: vector is empty");
+    value_type *tmp = allocate(v._size);
+    try {
+      construct_range(v._data, v._size, tmp);
+    } catch (...) {
+      this->deallocate(tmp, v._size);
+      throw;
     }
-    return _data[_size - 1];
-  };
-
-  /// @brief Осуществляет прямой доступ к базовому массиву
-  /// @return ссылку на массив
-  T *data() noexcept { return _data; };
-
-  // Iterators
-  /// @brief Версия для обычных итераторов возвращает указатель на первый
-  /// элемент массива
-  /// @return указатель на первый элемент
-  iterator begin() { return iterator(_data); }
-
-  // /// @brief Версия для константных итераторов также возвращает указатель на
-  // /// первый элемент, но с учетом константности.
-  // /// @return указатель на первый элемент
-  const_iterator cbegin() const { return const_iterator(_data); }
-
-  /// @brief Возвращает указатель за последним элементом массива
-  /// @return указатель на область памяти за последним элементом массива
-  iterator end() { return _data + _size; }
-
-  // Capacity
-  /// @brief Проверяет, пуст ли контейнер
-  /// @return 1 - если пуст, 0 - если заполнен
-  bool empty() const { return _size == 0; };
-
-  /// @brief Возвращает размер вектора (количество элементов)
-  /// @return количество элементов вектора
-  size_type size() const noexcept { return _size; };
-
-  /// @brief Возвращает максимально возможный размер вектора
-  /// @return максимально возможное количество элементов в векторе
-  size_type max_size() const noexcept {
-    return std::numeric_limits<size_type>::max() / sizeof(value_type);
-  };
+    replace_storage(tmp, v._size);
+    _size = v._size;
+    return *this;
+  }
 
-  /// @brief Выделяет хранилище заданного размера, и копирует элементы в вновь
-  /// выделенный массив
-  /// @param size размер нового массива
-  void reserve(size_type size) {
-    if (size > max_size()) {
-      throw std::out_of_range("Error: too large size for reserve");
-    }
-    if (size > _capacity) {
-      value_type *tmp = _data;
-      _data = new value_type[size];
-      for (size_type i = 0; i < _size; ++i) {
-        _data[i] = tmp[i];
-      }
-      delete[] tmp;
-      _capacity = size;
+  /// @brief Перегрузка оператора присваивания переносом
+  /// @param v объект-вектор - источник значений для присваивания
+  vector &operator=(vector &&v) noexcept {
+    if (this != &v) {
+      this->release_all();
+      steal(v);
     }
-  };
-
-  /// @brief Возвращает количество элементов, которые могут храниться в
-  /// выделенном на данный момент хранилище
-  /// @return максимально возможное количество элементов, помещающихся в текущее
-  /// хранилище
-  size_type capacity() const noexcept { return _capacity; };
+    return *this;
+  }
 
   /// @brief Уменьшает использование памяти за счет освобождения неиспользуемой
   /// памяти
   void shrink_to_fit() {
-    _capacity = _size;
-    reserve(_capacity);
-  };
-
-  // Modifiers
-  /// @brief Удаляет содержимое вектора
-  void clear() { _size = 0; };
-
-  /// @brief Вставляет элемент в заданную позицию, и возвращает итератор,
-  /// указывающий на новую позицию
-  /// @param pos позиция, куда надо вставить новый элемент
-  /// @param value вставляемый элемент
-  /// @return итератор, указывающий на новую позицию
-  iterator insert(iterator pos, const_reference value) {
-    size_type idx = pos - begin();
-    if (idx > _size) {
-      throw std::out_of_range("Error: index out of range");
-    }
-    if (_size == _capacity) {
-      reserve(_capacity ? _capacity * 2 : 1);
-    }
-    iterator new_pos = begin() + idx;
-    for (iterator it = end(); it != new_pos; --it) {
-      *it = *(it - 1);
-    }
-    *new_pos = value;
-    ++_size;
-
-    return new_pos;
-  };
-
-  /// @brief Удаляет указанный элемент из вектора
-  /// @param pos итератор, указывающий на позицию стираемого элемента
-  void erase(iterator pos) {
-    size_type idx = &(*pos) - this->_data;
-    if (idx > _size || _size == 0) {
-      throw std::out_of_range("Error: index out ot range");
-    }
-    for (iterator it = pos; it != end() - 1; ++it) {
-      *it = *(it + 1);
-    }
-    --_size;
+    if (_capacity > _size) this->reallocate(_size);
   }
 
-  /// @brief Добавляет новый элемент в конец вектора
-  /// @param value новый элемент
-  void push_back(const_reference value) {
-    if (_size == _capacity) reserve(_capacity ? _capacity * 2 : 1);
-    _data[_size++] = value;
-  };
-
-  /// @brief Удаляет последний элемент вектора
-  void pop_back() {
-    if (_size == 0) {
-      throw std::length_error("Error: size == 0, nothing to pop_back");
-    }
-    --_size;
-    (_data + _size)->~value_type();
-  };
-
   /// @brief Обменивает содержимое вектоа с содержимым другого вектора
   /// @param other вектор для обмена
   void swap(vector &other) noexcept {
     std::swap(_data, other._data);
     std::swap(_size, other._size);
     std::swap(_capacity, other._capacity);
-  };
-
-  // BONUS
-  /// @brief Вставляет новые элементы непосредственно перед заданной позицией
-  /// @param pos позиция, перед которой надо вставить элементы
-  /// @param ...args элементы, которые необходимо вставить
-  /// @return  итератор на позиции стираемого элемента в векторе
-  template <typename... Args>
-  iterator insert_many(const_iterator pos, Args &&...args) {
-    vector<value_type> tmp{args...};
-    iterator cur_pos = begin() + (pos - cbegin());
-    for (size_t i = 0; i < tmp.size(); ++i) {
-      cur_pos = insert(cur_pos, tmp[i]);
-      ++cur_pos;
-    }
-    return cur_pos;
-  };
+    std::swap(_alloc, other._alloc);
+    std::swap(_stats, other._stats);
+  }
 
-  /// @brief Добавляет несколько новых элементов в конец вектора
-  /// @param ...args элементы, которые необходимо вставить
-  template <typename... Args>
-  void insert_many_back(Args &&...args) {
-    insert_many(end(), args...);
-  };
+ private:
+  /// @brief Забирает хранилище и статистику v, оставляя его пустым
+  void steal(vector &v) noexcept {
+    _data = v._data;
+    _size = v._size;
+    _capacity = v._capacity;
+    _stats = v._stats;
+    v._data = nullptr;
+    v._size = 0;
+    v._capacity = 0;
+    v._stats = growth_stats();
+  }
 };  // class vector
 
 }  // namespace rpc
 #include "rpc_iterators.h"
-#endif  // RPC_VECTOR_H
\ No newline at end of file
+#endif  // RPC_VECTOR_H
@@ -0,0 +1,739 @@
+#ifndef RPC_VECTOR_BASE_H
+#define RPC_VECTOR_BASE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef RPC_CHECKED_ITERATORS
+#include <cstdio>
+#include <cstdlib>
+#endif
+
+namespace rpc {
+
+#ifdef RPC_CHECKED_ITERATORS
+/// @brief Сообщает о нарушенной проверке RPC_CHECKED_ITERATORS и завершает
+/// программу
+[[noreturn]] inline void checked_failure(const char *message, const char *file,
+                                         int line) {
+  std::fprintf(stderr, "%s:%d: %s\n", file, line, message);
+  std::abort();
+}
+
+/// @brief Проверка, которую отладочный режим RPC_CHECKED_ITERATORS добавляет в
+/// доступ без проверки границ. Без него не генерирует кода
+#define RPC_CHECKED_ASSERT(condition, message) \
+  ((condition) ? void(0) : rpc::checked_failure(message, __FILE__, __LINE__))
+#else
+#define RPC_CHECKED_ASSERT(condition, message) ((void)0)
+#endif
+
+/// @brief Метка конструктора вектора из диапазона, аналог std::from_range
+/// из C++23
+struct from_range_t {
+  explicit from_range_t() = default;
+};
+inline constexpr from_range_t from_range{};
+
+/// @brief Элементы T можно копировать и переносить побайтно (memcpy): тип
+/// тривиально копируемый, а аллокатор создает их обычным placement new
+/// (std::allocator в C++17 объявляет construct, но делает именно это)
+template <typename T, typename Allocator, typename = void>
+struct is_bitwise_copyable : std::is_trivially_copyable<T> {};
+template <typename T, typename Allocator>
+struct is_bitwise_copyable<
+    T, Allocator,
+    std::void_t<decltype(std::declval<Allocator &>().construct(
+        std::declval<T *>(), std::declval<const T &>()))>>
+    : std::bool_constant<std::is_trivially_copyable_v<T> &&
+                         std::is_same_v<Allocator, std::allocator<T>>> {};
+
+/// @brief Геометрический рост емкости вектора: в Num / Den раз, но не
+/// меньше MinCapacity при первом выделении
+/// @tparam Num, Den множитель роста Num / Den, больше единицы
+/// @tparam MinCapacity наименьшая емкость выделяемого хранилища
+template <size_t Num, size_t Den, size_t MinCapacity = 1>
+struct geometric_growth {
+  static_assert(Den > 0 && Num > Den, "growth factor must exceed 1");
+
+  /// @brief Емкость нового хранилища
+  /// @param capacity текущая емкость
+  /// @param required сколько элементов должно поместиться, не больше max_size
+  /// @param max_size наибольшая возможная емкость
+  static size_t grow(size_t capacity, size_t required, size_t max_size) {
+    const size_t step = Num - Den;
+    size_t size = capacity / Den > (max_size - capacity) / step
+                      ? max_size
+                      : capacity + capacity / Den * step;
+    return std::max(std::min(std::max(size, MinCapacity), max_size),
+                    required);
+  }
+};
+
+/// @brief Рост емкости на постоянное число элементов: память сверх размера
+/// ограничена Increment элементами, но push_back в цикле становится O(n^2)
+/// @tparam Increment шаг роста
+/// @tparam MinCapacity наименьшая емкость выделяемого хранилища
+template <size_t Increment, size_t MinCapacity = Increment>
+struct fixed_growth {
+  static_assert(Increment > 0, "growth increment must be positive");
+
+  /// @brief Емкость нового хранилища, аргументы как у geometric_growth::grow
+  static size_t grow(size_t capacity, size_t required, size_t max_size) {
+    size_t size =
+        Increment > max_size - capacity ? max_size : capacity + Increment;
+    return std::max(std::min(std::max(size, MinCapacity), max_size),
+                    required);
+  }
+};
+
+/// @brief Рост вдвое, начиная с одного элемента (по умолчанию)
+using growth_2x = geometric_growth<2, 1>;
+
+/// @brief Рост в полтора раза: меньше памяти сверх размера, больше
+/// перевыделений
+using growth_1_5x = geometric_growth<3, 2>;
+
+/// @brief Статистика перевыделений хранилища вектора
+struct growth_stats {
+  /// число переходов в новое хранилище
+  size_t reallocs = 0;
+  /// сколько байт элементов перенесено в новые хранилища
+  size_t bytes_copied = 0;
+};
+
+/// @brief Общая часть rpc::vector и rpc::small_vector: хранилище, доступ к
+/// элементам, вставка, удаление и рост по GrowthPolicy. Наследники задают
+/// только, где лежат элементы до первого выделения памяти, и отвечают за
+/// конструкторы, присваивание, обмен и освобождение в деструкторе.
+/// Хранилище выделено аллокатором тогда и только тогда, когда емкость больше
+/// InlineCapacity: у rpc::vector это любая ненулевая емкость, у small_vector
+/// - емкость сверх встроенного буфера.
+/// @tparam T тип элементов
+/// @tparam Allocator аллокатор хранилища
+/// @tparam GrowthPolicy правило роста емкости
+/// @tparam InlineCapacity емкость хранилища, не требующего аллокатора
+template <typename T, typename Allocator, typename GrowthPolicy,
+          size_t InlineCapacity>
+class vector_base {
+ public:
+  /// @brief Тип элемента, хранящегося в контейнере
+  using value_type = T;
+
+  /// @brief Тип ссылки на элемент
+  using reference = value_type &;
+
+  /// @brief Тип константной ссылки на элемент
+  using const_reference = const value_type &;
+
+  /// @brief Тип для итерации по вектору
+  using iterator = T *;
+
+  /// @brief Константный тип для итерации по вектору
+  using const_iterator = const T *;
+
+  /// @brief Тип размера контейнера (стандартный тип size_t)
+  using size_type = size_t;
+
+  /// @brief Тип аллокатора
+  using allocator_type = Allocator;
+
+  /// @brief Правило роста емкости
+  using growth_policy = GrowthPolicy;
+
+ protected:
+  /// @brief Шаблоны с итераторами ввода участвуют в перегрузке, только если
+  /// It действительно итератор: vector(2, 3) не должен считаться диапазоном
+  template <typename It>
+  using input_iterator_t = std::enable_if_t<std::is_convertible_v<
+      typename std::iterator_traits<It>::iterator_category,
+      std::input_iterator_tag>>;
+
+  /// @brief Создает пустой вектор без хранилища
+  /// @param alloc аллокатор
+  explicit vector_base(const allocator_type &alloc = allocator_type()) noexcept
+      : _alloc(alloc), _data(nullptr), _size(0), _capacity(0) {}
+
+  /// @brief Элементы и хранилище освобождает наследник через release_all
+  ~vector_base() = default;
+
+ public:
+  // Element access
+  /// @brief Осуществляет доступ к элементу по его номеру, с проверкой границ
+  /// @param pos позиция элемента вектора
+  /// @return ссылку на элемент вектора
+  reference at(size_type pos) {
+    if (pos >= _size) {
+      throw std::out_of_range("Error: index out of range");
+    }
+    return _data[pos];
+  }
+
+  /// @brief Константный доступ к элементу по его номеру, с проверкой границ
+  /// @param pos позиция элемента вектора
+  /// @return константную ссылку на элемент вектора
+  const_reference at(size_type pos) const {
+    if (pos >= _size) {
+      throw std::out_of_range("Error: index out of range");
+    }
+    return _data[pos];
+  }
+
+  /// @brief Реализует оператор [] - доступ к элементу по номеру без проверки
+  /// границ (кроме режима RPC_CHECKED_ITERATORS), поэтому циклы по индексам
+  /// векторизуются
+  /// @param pos номер элемента в векторе, меньше size()
+  /// @return ссылку на элемент вектора
+  reference operator[](size_type pos) {
+    RPC_CHECKED_ASSERT(pos < _size, "rpc::vector index out of range");
+    return _data[pos];
+  }
+
+  /// @brief Реализует константный оператор [] - доступ к элементу по номеру
+  /// без проверки границ
+  /// @param pos номер элемента в векторе, меньше size()
+  /// @return константную ссылку на элемент вектора
+  const_reference operator[](size_type pos) const {
+    RPC_CHECKED_ASSERT(pos < _size, "rpc::vector index out of range");
+    return _data[pos];
+  }
+
+  /// @brief Осуществляет доступ к первому элементу вектора
+  /// @return константную ссылку на первый элемент вектора
+  const_reference front() const {
+    if (!_size) {
+      throw std::out_of_range("Error: vector is empty");
+    }
+    return _data[0];
+  }
+
+  /// @brief Осуществляет доступ к последнему элементу вектора
+  /// @return константную ссылку на последний элемент вектора
+  const_reference back() const {
+    if (!_size) {
+      throw std::out_of_range("Error: vector is empty");
+    }
+    return _data[_size - 1];
+  }
+
+  /// @brief Осуществляет прямой доступ к базовому массиву
+  /// @return указатель на хранилище элементов
+  T *data() noexcept { return _data; }
+  const T *data() const noexcept { return _data; }
+
+  // Iterators
+  iterator begin() noexcept { return _data; }
+  const_iterator begin() const noexcept { return _data; }
+  const_iterator cbegin() const noexcept { return _data; }
+  iterator end() noexcept { return _data + _size; }
+  const_iterator end() const noexcept { return _data + _size; }
+  const_iterator cend() const noexcept { return _data + _size; }
+
+  // Capacity
+  /// @brief Проверяет, пуст ли контейнер
+  bool empty() const noexcept { return _size == 0; }
+
+  /// @brief Возвращает размер вектора (количество элементов)
+  size_type size() const noexcept { return _size; }
+
+  /// @brief Возвращает максимально возможный размер вектора
+  size_type max_size() const noexcept {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type);
+  }
+
+  /// @brief Переносит элементы в хранилище заданной емкости, если текущего
+  /// не хватает
+  /// @param size требуемая емкость
+  void reserve(size_type size) {
+    if (size > max_size()) {
+      throw std::out_of_range("Error: too large size for reserve");
+    }
+    if (size > _capacity) reallocate(size);
+  }
+
+  /// @brief Возвращает количество элементов, которые могут храниться в
+  /// текущем хранилище
+  size_type capacity() const noexcept { return _capacity; }
+
+  /// @brief Статистика перевыделений хранилища: сколько раз элементы
+  /// переносились в новое хранилище и сколько байт при этом скопировано
+  const growth_stats &stats() const noexcept { return _stats; }
+
+  // Modifiers
+  /// @brief Удаляет содержимое вектора, хранилище остается
+  void clear() noexcept {
+    destroy_range(_data, _data + _size);
+    _size = 0;
+  }
+
+  /// @brief Заменяет содержимое вектора элементами диапазона [first, last).
+  /// Хранилище переиспользуется, если в него помещается весь диапазон
+  /// @param first итератор на первый элемент
+  /// @param last итератор за последним элементом
+  template <typename InputIt, typename = input_iterator_t<InputIt>>
+  void assign(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type n = std::distance(first, last);
+      if (n > _capacity) {
+        if (n > max_size()) {
+          throw std::length_error("Error: vector is too large");
+        }
+        value_type *tmp = allocate(n);
+        try {
+          construct_range(first, n, tmp);
+        } catch (...) {
+          deallocate(tmp, n);
+          throw;
+        }
+        replace_storage(tmp, n);
+        _size = n;
+        return;
+      }
+    }
+    clear();
+    insert(cend(), first, last);
+  }
+
+  /// @brief Заменяет содержимое вектора элементами списка
+  /// @param items список новых элементов
+  void assign(std::initializer_list<value_type> items) {
+    assign(items.begin(), items.end());
+  }
+
+  /// @brief Вставляет элемент в заданную позицию
+  /// @param pos позиция, куда надо вставить новый элемент
+  /// @param value вставляемый элемент
+  /// @return итератор, указывающий на новый элемент
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  /// @brief Вставляет элемент переносом в заданную позицию
+  /// @param pos позиция, куда надо вставить новый элемент
+  /// @param value вставляемый элемент
+  /// @return итератор, указывающий на новый элемент
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  /// @brief Вставляет элементы диапазона [first, last) перед заданной
+  /// позицией. Для прямых итераторов память выделяется не больше одного раза,
+  /// хвост сдвигается один раз, тривиально копируемые элементы копируются
+  /// через memmove/memcpy. Диапазон не должен указывать внутрь самого вектора
+  /// @param pos позиция, перед которой вставляются элементы
+  /// @param first итератор на первый элемент
+  /// @param last итератор за последним элементом
+  /// @return итератор на первый вставленный элемент
+  template <typename InputIt, typename = input_iterator_t<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type idx = pos - cbegin();
+    if (idx > _size) {
+      throw std::out_of_range("Error: index out of range");
+    }
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>) {
+      size_type n = std::distance(first, last);
+      if (n > _capacity - _size) {
+        realloc_insert_range(idx, first, n);
+      } else if (n) {
+        insert_range_in_place(idx, first, n);
+      }
+    } else {
+      // длина однопроходного диапазона неизвестна: дописываем в конец и
+      // поворачиваем на место
+      size_type old_size = _size;
+      for (; first != last; ++first) emplace_back(*first);
+      std::rotate(_data + idx, _data + old_size, _data + _size);
+    }
+    return begin() + idx;
+  }
+
+  /// @brief Создает элемент на месте перед заданной позицией
+  /// @param pos позиция, перед которой создается элемент
+  /// @param ...args аргументы конструктора элемента
+  /// @return итератор, указывающий на новый элемент
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type idx = pos - cbegin();
+    if (idx > _size) {
+      throw std::out_of_range("Error: index out of range");
+    }
+    if (_size == _capacity) {
+      realloc_insert(idx, std::forward<Args>(args)...);
+    } else if (idx == _size) {
+      alloc_traits::construct(_alloc, _data + _size,
+                              std::forward<Args>(args)...);
+      ++_size;
+    } else {
+      value_type tmp(std::forward<Args>(args)...);
+      if constexpr (kBitwise) {
+        shift_bytes(_data + idx + 1, _data + idx, _size - idx);
+        std::memcpy(static_cast<void *>(_data + idx), &tmp, sizeof(value_type));
+        ++_size;
+      } else {
+        alloc_traits::construct(_alloc, _data + _size,
+                                std::move(_data[_size - 1]));
+        ++_size;
+        std::move_backward(_data + idx, _data + _size - 2, _data + _size - 1);
+        _data[idx] = std::move(tmp);
+      }
+    }
+    return begin() + idx;
+  }
+
+  /// @brief Удаляет указанный элемент из вектора
+  /// @param pos итератор, указывающий на позицию стираемого элемента
+  /// @return итератор на элемент, следовавший за удаленным
+  iterator erase(const_iterator pos) {
+    std::ptrdiff_t idx = pos - cbegin();
+    if (idx < 0 || static_cast<size_type>(idx) >= _size) {
+      throw std::out_of_range("Error: index out ot range");
+    }
+    return erase(pos, pos + 1);
+  }
+
+  /// @brief Удаляет элементы [first, last), сдвигая хвост один раз
+  /// @param first итератор на первый удаляемый элемент
+  /// @param last итератор за последним удаляемым элементом
+  /// @return итератор на элемент, следовавший за удаленными
+  iterator erase(const_iterator first, const_iterator last) {
+    // границы проверяются по индексам: у пустого вектора _data == nullptr, и
+    // до shift_bytes не должен доходить ни один путь с нулевым указателем
+    std::ptrdiff_t from = first - cbegin();
+    std::ptrdiff_t to = last - cbegin();
+    if (from < 0 || to < from || static_cast<size_type>(to) > _size) {
+      throw std::out_of_range("Error: index out ot range");
+    }
+    if (from == to) return begin() + from;
+    size_type n = to - from;
+    if constexpr (kBitwise) {
+      shift_bytes(_data + from, _data + to, _size - to);
+    } else {
+      std::move(_data + to, _data + _size, _data + from);
+      destroy_range(_data + _size - n, _data + _size);
+    }
+    _size -= n;
+    return begin() + from;
+  }
+
+  /// @brief Добавляет новый элемент в конец вектора
+  /// @param value новый элемент
+  void push_back(const_reference value) { emplace_back(value); }
+
+  /// @brief Добавляет новый элемент в конец вектора переносом
+  /// @param value новый элемент
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  /// @brief Создает новый элемент на месте в конце вектора
+  /// @param ...args аргументы конструктора элемента
+  /// @return ссылку на новый элемент
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (_size == _capacity) {
+      realloc_insert(_size, std::forward<Args>(args)...);
+    } else {
+      alloc_traits::construct(_alloc, _data + _size,
+                              std::forward<Args>(args)...);
+      ++_size;
+    }
+    return _data[_size - 1];
+  }
+
+  /// @brief Добавляет в конец вектора элементы диапазона
+  /// @param range диапазон с begin() и end()
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(cend(), std::begin(range), std::end(range));
+  }
+
+  /// @brief Удаляет последний элемент вектора
+  void pop_back() {
+    if (_size == 0) {
+      throw std::length_error("Error: size == 0, nothing to pop_back");
+    }
+    --_size;
+    alloc_traits::destroy(_alloc, _data + _size);
+  }
+
+  // BONUS
+  /// @brief Вставляет новые элементы непосредственно перед заданной позицией
+  /// @param pos позиция, перед которой надо вставить элементы
+  /// @param ...args элементы, которые необходимо вставить
+  /// @return итератор за последним вставленным элементом
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args) {
+    std::initializer_list<value_type> items{args...};
+    return insert(pos, items.begin(), items.end()) + items.size();
+  }
+
+  /// @brief Добавляет несколько новых элементов в конец вектора
+  /// @param ...args элементы, которые необходимо вставить
+  template <typename... Args>
+  void insert_many_back(Args &&...args) {
+    insert_many(cend(), args...);
+  }
+
+ protected:
+  /// @brief Операции над аллокатором
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  /// @brief Элементы копируются и переносятся через memcpy/memmove
+  static constexpr bool kBitwise =
+      is_bitwise_copyable<value_type, Allocator>::value;
+
+  /// @brief Хранилище выделено аллокатором, а не задано наследником
+  bool on_heap() const noexcept { return _capacity > InlineCapacity; }
+
+  /// @brief Выделяет неинициализированное хранилище
+  /// @param n количество элементов
+  /// @return указатель на хранилище или nullptr при n == 0
+  value_type *allocate(size_type n) {
+    return n ? alloc_traits::allocate(_alloc, n) : nullptr;
+  }
+
+  /// @brief Освобождает хранилище без вызова деструкторов
+  /// @param ptr указатель на хранилище
+  /// @param n количество элементов, под которое оно выделялось
+  void deallocate(value_type *ptr, size_type n) noexcept {
+    if (ptr) alloc_traits::deallocate(_alloc, ptr, n);
+  }
+
+  /// @brief Освобождает текущее хранилище, если оно выделено аллокатором,
+  /// без вызова деструкторов
+  void release() noexcept {
+    if (on_heap()) alloc_traits::deallocate(_alloc, _data, _capacity);
+  }
+
+  /// @brief Разрушает элементы и освобождает хранилище, для деструкторов
+  void release_all() noexcept {
+    destroy_range(_data, _data + _size);
+    release();
+  }
+
+  /// @brief Побайтно переносит n элементов из src в dest, диапазоны могут
+  /// перекрываться. Только для kBitwise. У пустого вектора _data == nullptr,
+  /// а memmove с нулевым указателем - UB даже при n == 0
+  static void shift_bytes(value_type *dest, const value_type *src,
+                          size_type n) noexcept {
+    if (n && dest && src) {
+      std::memmove(static_cast<void *>(dest), src, n * sizeof(value_type));
+    }
+  }
+
+  /// @brief Вызывает деструкторы элементов диапазона
+  void destroy_range(value_type *first, value_type *last) noexcept {
+    for (; first != last; ++first) alloc_traits::destroy(_alloc, first);
+  }
+
+  /// @brief Переносит элементы [first, last) в неинициализированную память
+  /// dest: перемещением, если оно не бросает исключений, иначе копированием,
+  /// тривиально копируемые элементы - одним memcpy.
+  /// При исключении уже созданные элементы разрушаются.
+  /// @return указатель за последним созданным элементом
+  value_type *relocate(value_type *first, value_type *last, value_type *dest) {
+    if constexpr (kBitwise) {
+      return construct_range(first, last - first, dest);
+    } else {
+      value_type *cur = dest;
+      try {
+        for (; first != last; ++first, ++cur) {
+          alloc_traits::construct(_alloc, cur, std::move_if_noexcept(*first));
+        }
+      } catch (...) {
+        destroy_range(dest, cur);
+        throw;
+      }
+      return cur;
+    }
+  }
+
+  /// @brief Создает в неинициализированной памяти dest копии n элементов,
+  /// начиная с first. Из массива тех же тривиально копируемых элементов
+  /// копирует одним memcpy. При исключении созданные элементы разрушаются
+  /// @return указатель за последним созданным элементом
+  template <typename ForwardIt>
+  value_type *construct_range(ForwardIt first, size_type n, value_type *dest) {
+    using source_type = std::remove_cv_t<std::remove_pointer_t<ForwardIt>>;
+    if constexpr (kBitwise && std::is_pointer_v<ForwardIt> &&
+                  std::is_same_v<source_type, value_type>) {
+      if (n) {
+        std::memcpy(static_cast<void *>(dest), first, n * sizeof(value_type));
+      }
+      return dest + n;
+    } else if constexpr (kBitwise) {
+      return std::uninitialized_copy_n(first, n, dest);
+    } else {
+      value_type *cur = dest;
+      try {
+        for (; n; --n, ++first, ++cur) {
+          alloc_traits::construct(_alloc, cur, *first);
+        }
+      } catch (...) {
+        destroy_range(dest, cur);
+        throw;
+      }
+      return cur;
+    }
+  }
+
+  /// @brief Емкость нового хранилища для n дополнительных элементов по
+  /// правилу GrowthPolicy, не меньше нужной
+  /// @param n количество добавляемых элементов
+  size_type next_capacity(size_type n) const {
+    if (n > max_size() - _size) {
+      throw std::length_error("Error: vector is too large");
+    }
+    return GrowthPolicy::grow(_capacity, _size + n, max_size());
+  }
+
+  /// @brief Учитывает переход в новое хранилище со старыми элементами
+  void record_realloc() noexcept {
+    ++_stats.reallocs;
+    _stats.bytes_copied += _size * sizeof(value_type);
+  }
+
+  /// @brief Разрушает старые элементы и делает data текущим хранилищем
+  /// @param data новое хранилище с уже созданными элементами
+  /// @param capacity его емкость
+  void replace_storage(value_type *data, size_type capacity) noexcept {
+    destroy_range(_data, _data + _size);
+    release();
+    _data = data;
+    _capacity = capacity;
+  }
+
+  /// @brief Переносит элементы в новое хранилище заданной емкости
+  /// @param size новая емкость (не меньше _size)
+  void reallocate(size_type size) {
+    value_type *tmp = allocate(size);
+    try {
+      relocate(_data, _data + _size, tmp);
+    } catch (...) {
+      deallocate(tmp, size);
+      throw;
+    }
+    record_realloc();
+    replace_storage(tmp, size);
+  }
+
+  /// @brief Вставка в заполненный вектор: новый элемент создается в новом
+  /// хранилище до переноса старых, поэтому args может ссылаться на элемент
+  /// самого вектора
+  /// @param idx позиция нового элемента
+  /// @param ...args аргументы конструктора нового элемента
+  template <typename... Args>
+  void realloc_insert(size_type idx, Args &&...args) {
+    size_type size = next_capacity(1);
+    value_type *tmp = allocate(size);
+    value_type *cur = tmp;
+    try {
+      alloc_traits::construct(_alloc, tmp + idx, std::forward<Args>(args)...);
+      try {
+        cur = relocate(_data, _data + idx, tmp);
+        relocate(_data + idx, _data + _size, tmp + idx + 1);
+      } catch (...) {
+        destroy_range(tmp, cur);
+        alloc_traits::destroy(_alloc, tmp + idx);
+        throw;
+      }
+    } catch (...) {
+      deallocate(tmp, size);
+      throw;
+    }
+    record_realloc();
+    replace_storage(tmp, size);
+    ++_size;
+  }
+
+  /// @brief Вставка диапазона, не помещающегося в хранилище: новые элементы
+  /// создаются в новом хранилище, затем туда переносятся старые
+  /// @param idx позиция первого нового элемента
+  /// @param first итератор на первый элемент диапазона
+  /// @param n длина диапазона
+  template <typename ForwardIt>
+  void realloc_insert_range(size_type idx, ForwardIt first, size_type n) {
+    size_type size = next_capacity(n);
+    value_type *tmp = allocate(size);
+    value_type *cur = tmp;
+    try {
+      construct_range(first, n, tmp + idx);
+      try {
+        cur = relocate(_data, _data + idx, tmp);
+        relocate(_data + idx, _data + _size, tmp + idx + n);
+      } catch (...) {
+        destroy_range(tmp, cur);
+        destroy_range(tmp + idx, tmp + idx + n);
+        throw;
+      }
+    } catch (...) {
+      deallocate(tmp, size);
+      throw;
+    }
+    record_realloc();
+    replace_storage(tmp, size);
+    _size += n;
+  }
+
+  /// @brief Вставка диапазона, помещающегося в хранилище: хвост [idx, _size)
+  /// сдвигается на n позиций один раз
+  /// @param idx позиция первого нового элемента
+  /// @param first итератор на первый элемент диапазона
+  /// @param n длина диапазона, больше нуля
+  template <typename ForwardIt>
+  void insert_range_in_place(size_type idx, ForwardIt first, size_type n) {
+    value_type *pos = _data + idx;
+    value_type *old_end = _data + _size;
+    const size_type after = _size - idx;
+    if constexpr (kBitwise) {
+      shift_bytes(pos + n, pos, after);
+      construct_range(first, n, pos);
+      _size += n;
+    } else if (after > n) {
+      relocate(old_end - n, old_end, old_end);
+      _size += n;
+      std::move_backward(pos, old_end - n, old_end);
+      std::copy_n(first, n, pos);
+    } else {
+      // часть диапазона за старым концом создается, остальная присваивается
+      ForwardIt mid = std::next(first, after);
+      value_type *cur = construct_range(mid, n - after, old_end);
+      try {
+        relocate(pos, old_end, cur);
+      } catch (...) {
+        destroy_range(old_end, cur);
+        throw;
+      }
+      _size += n;
+      std::copy(first, mid, pos);
+    }
+  }
+
+  // Fields
+  /// @brief Аллокатор хранилища
+  allocator_type _alloc;
+
+  /// @brief Указатель, хранящий положение первого элемента данных
+  value_type *_data;
+
+  /// @brief Количество элементов, хранимых в векторе
+  size_type _size;
+
+  /// @brief Полный объем памяти, выделенный под данные
+  size_type _capacity;
+
+  /// @brief Статистика перевыделений
+  growth_stats _stats;
+};  // class vector_base
+
+}  // namespace rpc
+
+#endif  // RPC_VECTOR_BASE_H
@@ -0,0 +1,104 @@
+#include <list>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rpc_test.h"
+
+TEST(pool_allocator, case1_reuse) {
+  rpc::pool_allocator<double> alloc;
+  double *first = alloc.allocate(1);
+  alloc.deallocate(first, 1);
+  double *second = alloc.allocate(1);
+  EXPECT_EQ(first, second);
+  alloc.deallocate(second, 1);
+}
+
+TEST(pool_allocator, case2_distinct_blocks) {
+  rpc::pool_allocator<long long> alloc;
+  std::list<long long *> blocks;
+  for (int i = 0; i < 10000; ++i) {
+    long long *block = alloc.allocate(1);
+    *block = i;
+    blocks.push_back(block);
+  }
+  int expected = 0;
+  for (long long *block : blocks) {
+    EXPECT_EQ(*block, expected++);
+    alloc.deallocate(block, 1);
+  }
+}
+
+TEST(pool_allocator, case3_array) {
+  rpc::pool_allocator<int> alloc;
+  int *array = alloc.allocate(100);
+  for (int i = 0; i < 100; ++i) array[i] = i;
+  EXPECT_EQ(array[99], 99);
+  alloc.deallocate(array, 100);
+}
+
+TEST(pool_allocator, case4_equal) {
+  rpc::pool_allocator<int> a;
+  rpc::pool_allocator<std::string> b(a);
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a != b);
+}
+
+TEST(pool_allocator, case5_threads) {
+  const int n = 100000;
+  auto work = [n] {
+    rpc::list<int> list;
+    for (int i = 0; i < n; ++i) list.push_back(i);
+    int sum = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) sum += *it % 2;
+    return sum;
+  };
+  int sum1 = 0, sum2 = 0;
+  std::thread t1([&] { sum1 = work(); });
+  std::thread t2([&] { sum2 = work(); });
+  t1.join();
+  t2.join();
+  EXPECT_EQ(sum1, n / 2);
+  EXPECT_EQ(sum2, n / 2);
+}
+
+TEST(pool_allocator, case6_cross_thread_free) {
+  rpc::list<std::string> *list = new rpc::list<std::string>;
+  std::thread producer([list] {
+    for (int i = 0; i < 1000; ++i) list->push_back(std::to_string(i));
+  });
+  producer.join();
+  EXPECT_EQ(list->back(), "999");
+  delete list;
+}
+
+TEST(pool_allocator, case7_std_allocator) {
+  rpc::set<int, std::allocator<int>> set = {3, 1, 2};
+  rpc::map<int, int, std::allocator<std::pair<const int, int>>> map{{1, 1}};
+  rpc::list<int, std::allocator<int>> list = {1, 2};
+  rpc::queue<int, std::allocator<int>> queue = {1, 2};
+  EXPECT_EQ(*set.begin(), 1);
+  EXPECT_EQ(map.at(1), 1);
+  EXPECT_EQ(list.back(), 2);
+  EXPECT_EQ(queue.back(), 2);
+}
+
+TEST(pool_allocator, case8_cross_thread_reuse) {
+  struct alignas(32) Payload {
+    char bytes[96];
+  };
+  using pool = rpc::fixed_block_pool<sizeof(Payload), alignof(Payload)>;
+  rpc::pool_allocator<Payload> alloc;
+  std::vector<Payload *> blocks(20000);
+  std::size_t slabs = 0;
+  for (int round = 0; round < 10; ++round) {
+    std::thread producer([&] {
+      for (Payload *&block : blocks) block = alloc.allocate(1);
+    });
+    producer.join();
+    for (Payload *block : blocks) alloc.deallocate(block, 1);
+    // кэш этого потока ограничен, остальные блоки видны следующему потоку
+    if (round == 2) slabs = pool::slab_count();
+  }
+  EXPECT_EQ(pool::slab_count(), slabs);
+}
@@ -0,0 +1,77 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rpc_test.h"
+
+TEST(concurrent_stack, push_pop) {
+  rpc::concurrent_stack<std::string> stack;
+  EXPECT_TRUE(stack.empty());
+  stack.push("one");
+  stack.push(std::string("two"));
+  stack.emplace(3, 'x');
+  std::string value;
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(value, "xxx");
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(value, "two");
+  EXPECT_TRUE(stack.try_pop(value));
+  EXPECT_EQ(value, "one");
+  EXPECT_FALSE(stack.try_pop(value));
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack, reuses_nodes) {
+  rpc::concurrent_stack<int, rpc::pool_allocator<int>> stack;
+  stack.reserve(2);
+  int value;
+  for (int i = 0; i < 100; ++i) {
+    stack.push(i);
+    stack.push(i + 1);
+    EXPECT_TRUE(stack.try_pop(value));
+    EXPECT_EQ(value, i + 1);
+    EXPECT_TRUE(stack.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_TRUE(stack.empty());
+}
+
+TEST(concurrent_stack, destroys_remaining) {
+  auto value = std::make_shared<int>(1);
+  {
+    rpc::concurrent_stack<std::shared_ptr<int>> stack;
+    for (int i = 0; i < 5; ++i) stack.push(value);
+    std::shared_ptr<int> out;
+    stack.try_pop(out);
+    out.reset();
+    EXPECT_EQ(value.use_count(), 5);
+  }
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+// Потоки перемешивают push и pop одних и тех же узлов, что провоцирует ABA.
+// Каждое положенное значение должно быть снято ровно один раз
+TEST(concurrent_stack, stress) {
+  const int threads = 8, per_thread = 20000;
+  rpc::concurrent_stack<int> stack;
+  std::vector<std::vector<int>> popped(threads);
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&stack, &popped, t] {
+      int value;
+      for (int i = 0; i < per_thread; ++i) {
+        stack.push(t * per_thread + i);
+        if (i % 2 && stack.try_pop(value)) popped[t].push_back(value);
+      }
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+  std::vector<int> seen(threads * per_thread, 0);
+  for (const std::vector<int> &values : popped) {
+    for (int value : values) ++seen[value];
+  }
+  int value;
+  while (stack.try_pop(value)) ++seen[value];
+  for (int count : seen) ASSERT_EQ(count, 1);
+}
@@ -0,0 +1,148 @@
+#include <iterator>
+#include <vector>
+
+#include "rpc_test.h"
+
+namespace {
+
+// Объект из арены: через by_id входит в один список, через by_state - в
+// другой
+struct Connection {
+  int id;
+  int state;
+  rpc::list_hook by_id;
+  rpc::list_hook by_state;
+  Connection(int id, int state = 0) : id(id), state(state) {}
+  bool operator<(const Connection& other) const { return id < other.id; }
+  bool operator==(const Connection& other) const { return id == other.id; }
+};
+
+using IdList = rpc::intrusive_list<Connection, &Connection::by_id>;
+using StateList = rpc::intrusive_list<Connection, &Connection::by_state>;
+
+// Проходит список в обе стороны: проверяет и next_, и prev_
+void ExpectIds(const IdList& list, const std::vector<int>& ids) {
+  ASSERT_EQ(list.size(), ids.size());
+  auto it = list.begin();
+  for (int id : ids) {
+    EXPECT_EQ(it->id, id);
+    ++it;
+  }
+  EXPECT_TRUE(it == list.end());
+  for (auto id = ids.rbegin(); id != ids.rend(); ++id) {
+    EXPECT_EQ((--it)->id, *id);
+  }
+}
+
+}  // namespace
+
+TEST(intrusive_list, link_and_erase_by_reference) {
+  std::vector<Connection> arena{1, 2, 3, 4};
+  IdList list;
+  for (Connection& connection : arena) list.push_back(connection);
+  EXPECT_TRUE(arena[2].by_id.is_linked());
+  EXPECT_FALSE(arena[2].by_state.is_linked());
+  ExpectIds(list, {1, 2, 3, 4});
+
+  list.erase(arena[2]);
+  EXPECT_FALSE(arena[2].by_id.is_linked());
+  ExpectIds(list, {1, 2, 4});
+  EXPECT_EQ(&*IdList::iterator_to(arena[1]), &arena[1]);
+  auto next = list.erase(IdList::iterator_to(arena[1]));
+  EXPECT_EQ(next->id, 4);
+  EXPECT_THROW(list.erase(list.end()), std::logic_error);
+  // несвязанный объект: размер и чужие звенья не меняются
+  EXPECT_THROW(list.erase(arena[2]), std::logic_error);
+  EXPECT_EQ(list.size(), 2U);
+
+  list.push_front(arena[2]);
+  EXPECT_THROW(list.push_back(arena[2]), std::logic_error);
+  EXPECT_EQ(list.front().id, 3);
+  EXPECT_EQ(list.back().id, 4);
+  list.insert(IdList::iterator_to(arena[0]), arena[1]);
+  ExpectIds(list, {3, 2, 1, 4});
+  list.pop_front();
+  list.pop_back();
+  ExpectIds(list, {2, 1});
+  EXPECT_FALSE(arena[3].by_id.is_linked());
+
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  for (const Connection& connection : arena) {
+    EXPECT_FALSE(connection.by_id.is_linked());
+  }
+}
+
+TEST(intrusive_list, two_hooks) {
+  std::vector<Connection> arena{{1, 0}, {2, 1}, {3, 0}};
+  IdList all;
+  StateList idle;
+  for (Connection& connection : arena) {
+    all.push_back(connection);
+    if (connection.state == 0) idle.push_back(connection);
+  }
+  idle.erase(arena[0]);
+  EXPECT_EQ(idle.size(), 1U);
+  EXPECT_EQ(idle.front().id, 3);
+  ExpectIds(all, {1, 2, 3});
+  {
+    StateList scoped;
+    scoped.push_back(arena[1]);
+  }
+  EXPECT_FALSE(arena[1].by_state.is_linked());
+}
+
+TEST(intrusive_list, algorithms_relink_objects) {
+  // объекты должны пережить списки, в которые входят
+  std::vector<Connection> arena{5, 1, 4, 1, 3, 2, 2, 6};
+  std::vector<Connection> more{0, 3, 7};
+  IdList list;
+  for (Connection& connection : arena) list.push_back(connection);
+  list.sort();
+  ExpectIds(list, {1, 1, 2, 2, 3, 4, 5, 6});
+  // сортировка устойчива и не перемещает объекты
+  EXPECT_EQ(&list.front(), &arena[1]);
+  list.unique();
+  ExpectIds(list, {1, 2, 3, 4, 5, 6});
+  EXPECT_FALSE(arena[3].by_id.is_linked());
+  list.reverse();
+  ExpectIds(list, {6, 5, 4, 3, 2, 1});
+  list.sort([](const Connection& a, const Connection& b) { return b < a; });
+  ExpectIds(list, {6, 5, 4, 3, 2, 1});
+  list.reverse();
+
+  IdList other;
+  for (Connection& connection : more) other.push_back(connection);
+  list.merge(other);
+  EXPECT_TRUE(other.empty());
+  ExpectIds(list, {0, 1, 2, 3, 3, 4, 5, 6, 7});
+  // из равных первым идет объект этого списка
+  EXPECT_EQ(&*std::next(list.begin(), 3), &arena[4]);
+
+  other.splice(other.end(), list, IdList::iterator_to(more[1]));
+  other.splice(other.begin(), list, list.begin(),
+               IdList::iterator_to(arena[5]));
+  ExpectIds(other, {0, 1, 3});
+  ExpectIds(list, {2, 3, 4, 5, 6, 7});
+  list.splice(list.begin(), other);
+  ExpectIds(list, {0, 1, 3, 2, 3, 4, 5, 6, 7});
+
+  IdList moved(std::move(list));
+  EXPECT_TRUE(list.empty());
+  moved.swap(list);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(list.size(), 9U);
+  EXPECT_EQ(list.back().id, 7);
+}
+
+TEST(intrusive_list, owner_before_first_insert) {
+  // смещение звена известно до первой вставки в список этого типа
+  struct Tagged {
+    char tag;
+    rpc::list_hook hook;
+  };
+  using TaggedList = rpc::intrusive_list<Tagged, &Tagged::hook>;
+  Tagged value{'x', {}};
+  EXPECT_EQ(&*TaggedList::iterator_to(value), &value);
+  EXPECT_EQ(TaggedList::iterator_to(value)->tag, 'x');
+}
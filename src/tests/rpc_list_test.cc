@@ -1,4 +1,6 @@
+#include <iterator>
 #include <list>
+#include <type_traits>
 
 #include "rpc_test.h"
 
@@ -193,6 +195,39 @@ TEST(List, Iterator_Equals) {
   EXPECT_TRUE(our_it_first != our_it_second);
 }
 
+TEST(List, Iterator_Const) {
+  const rpc::list<int> our_list = {1, 2, 3};
+  rpc::list<int>::const_iterator our_it = our_list.begin();
+  EXPECT_EQ(*our_it, 1);
+  our_it = our_list.end();
+  EXPECT_EQ(*--our_it, 3);
+  EXPECT_EQ(std::distance(our_list.begin(), our_list.end()), 3);
+  static_assert(std::is_same<decltype(*our_it), const int&>::value,
+                "const_iterator must yield const_reference");
+
+  rpc::list<int> mutable_list = {4, 5};
+  rpc::list<int>::const_iterator mutable_it = mutable_list.begin();
+  EXPECT_TRUE(mutable_it == mutable_list.cbegin());
+  EXPECT_TRUE(mutable_list.begin() != mutable_list.cend());
+  *mutable_list.begin() = 6;
+  EXPECT_EQ(*mutable_it, 6);
+}
+
+TEST(List, Iterator_Single_Pointer) {
+  static_assert(sizeof(rpc::list<int>::iterator) == sizeof(void*),
+                "iterator must be a single node pointer");
+  static_assert(sizeof(rpc::list<int>::const_iterator) == sizeof(void*),
+                "const_iterator must be a single node pointer");
+  rpc::list<int> our_list = {1, 2};
+  // end() - сторожевой узел кольца: из него можно шагнуть к обоим концам
+  auto our_it = our_list.end();
+  EXPECT_EQ(*++our_it, 1);
+  our_it = our_list.end();
+  EXPECT_EQ(*--our_it, 2);
+  rpc::list<int> empty_list;
+  EXPECT_TRUE(empty_list.begin() == empty_list.end());
+}
+
 TEST(List, Insert) {
   rpc::list<int> our_list;
   std::list<int> std_list;
@@ -242,6 +277,156 @@ TEST(List, Splice) {
   EXPECT_EQ(our_list_first.back(), std_list_first.back());
 }
 
+namespace {
+
+// Проходит список в обе стороны: проверяет и next_, и prev_
+void ExpectListEq(const rpc::list<int>& our_list,
+                  const std::list<int>& std_list) {
+  ASSERT_EQ(our_list.size(), std_list.size());
+  auto it = our_list.begin();
+  for (int value : std_list) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == our_list.end());
+  for (auto std_it = std_list.rbegin(); std_it != std_list.rend(); ++std_it) {
+    EXPECT_EQ(*--it, *std_it);
+  }
+  EXPECT_TRUE(it == our_list.begin());
+}
+
+// Считает копирования: splice и merge не должны копировать значения
+struct CopyCounted {
+  static int copies;
+  int value;
+  CopyCounted(int v) : value(v) {}
+  CopyCounted(const CopyCounted& other) : value(other.value) { ++copies; }
+  CopyCounted& operator=(const CopyCounted& other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  bool operator<(const CopyCounted& other) const { return value < other.value; }
+};
+int CopyCounted::copies = 0;
+
+}  // namespace
+
+TEST(List, Splice_Whole_Relinks) {
+  rpc::list<int> our_list_first = {1, 2};
+  rpc::list<int> our_list_second = {3, 4, 5};
+  std::list<int> std_list_first = {1, 2};
+  std::list<int> std_list_second = {3, 4, 5};
+  int* node = &*our_list_second.begin();
+  our_list_first.splice(++our_list_first.begin(), our_list_second);
+  std_list_first.splice(++std_list_first.begin(), std_list_second);
+  ExpectListEq(our_list_first, std_list_first);
+  EXPECT_TRUE(our_list_second.empty());
+  EXPECT_TRUE(our_list_second.begin() == our_list_second.end());
+  EXPECT_EQ(&*++our_list_first.begin(), node);
+
+  our_list_second.splice(our_list_second.end(), our_list_first);
+  ExpectListEq(our_list_second, std_list_first);
+  EXPECT_TRUE(our_list_first.empty());
+  our_list_second.push_back(6);
+  EXPECT_EQ(our_list_second.back(), 6);
+  EXPECT_EQ(our_list_second.size(), 6U);
+}
+
+TEST(List, Splice_Single) {
+  rpc::list<int> our_list_first = {1, 2, 3};
+  rpc::list<int> our_list_second = {4, 5, 6};
+  std::list<int> std_list_first = {1, 2, 3};
+  std::list<int> std_list_second = {4, 5, 6};
+  our_list_first.splice(our_list_first.begin(), our_list_second,
+                        --our_list_second.end());
+  std_list_first.splice(std_list_first.begin(), std_list_second,
+                        --std_list_second.end());
+  ExpectListEq(our_list_first, std_list_first);
+  ExpectListEq(our_list_second, std_list_second);
+
+  // внутри одного списка: первый элемент в конец и на свое же место
+  our_list_first.splice(our_list_first.end(), our_list_first,
+                        our_list_first.begin());
+  std_list_first.splice(std_list_first.end(), std_list_first,
+                        std_list_first.begin());
+  our_list_first.splice(our_list_first.begin(), our_list_first,
+                        our_list_first.begin());
+  ExpectListEq(our_list_first, std_list_first);
+  EXPECT_THROW(our_list_first.splice(our_list_first.begin(), our_list_second,
+                                     our_list_second.end()),
+               std::logic_error);
+}
+
+TEST(List, Splice_Range) {
+  rpc::list<int> our_list_first = {1, 2, 3};
+  rpc::list<int> our_list_second = {4, 5, 6, 7, 8};
+  std::list<int> std_list_first = {1, 2, 3};
+  std::list<int> std_list_second = {4, 5, 6, 7, 8};
+  auto our_first = ++our_list_second.begin();
+  auto our_last = --our_list_second.end();
+  auto std_first = ++std_list_second.begin();
+  auto std_last = --std_list_second.end();
+  our_list_first.splice(our_list_first.end(), our_list_second, our_first,
+                        our_last);
+  std_list_first.splice(std_list_first.end(), std_list_second, std_first,
+                        std_last);
+  ExpectListEq(our_list_first, std_list_first);
+  ExpectListEq(our_list_second, std_list_second);
+
+  // диапазон до конца другого списка и внутри одного списка
+  our_list_first.splice(our_list_first.begin(), our_list_second,
+                        ++our_list_second.begin(), our_list_second.end());
+  std_list_first.splice(std_list_first.begin(), std_list_second,
+                        ++std_list_second.begin(), std_list_second.end());
+  our_list_first.splice(our_list_first.begin(), our_list_first,
+                        --(--our_list_first.end()), our_list_first.end());
+  std_list_first.splice(std_list_first.begin(), std_list_first,
+                        --(--std_list_first.end()), std_list_first.end());
+  ExpectListEq(our_list_first, std_list_first);
+  ExpectListEq(our_list_second, std_list_second);
+}
+
+TEST(List, Splice_No_Copies) {
+  rpc::list<CopyCounted> our_list_first = {1, 2};
+  rpc::list<CopyCounted> our_list_second = {3, 4, 5};
+  CopyCounted::copies = 0;
+  our_list_first.splice(our_list_first.begin(), our_list_second);
+  our_list_second.splice(our_list_second.end(), our_list_first,
+                         our_list_first.begin());
+  our_list_second.splice(our_list_second.begin(), our_list_first,
+                         our_list_first.begin(), our_list_first.end());
+  EXPECT_EQ(CopyCounted::copies, 0);
+  EXPECT_EQ(our_list_second.size(), 5U);
+  EXPECT_TRUE(our_list_first.empty());
+}
+
+TEST(List, Move_Swap_Keep_Iterators) {
+  rpc::list<int> our_list_first = {1, 2, 3};
+  rpc::list<int> our_list_second = {4};
+  auto our_it = ++our_list_first.begin();
+  rpc::list<int> our_moved(std::move(our_list_first));
+  EXPECT_TRUE(our_list_first.empty());
+  EXPECT_TRUE(our_list_first.begin() == our_list_first.end());
+  EXPECT_EQ(*our_it, 2);
+  ExpectListEq(our_moved, {1, 2, 3});
+
+  our_moved.swap(our_list_second);
+  ExpectListEq(our_moved, {4});
+  ExpectListEq(our_list_second, {1, 2, 3});
+  EXPECT_EQ(*++our_it, 3);
+  EXPECT_TRUE(++our_it == our_list_second.end());
+
+  our_list_first = our_list_second;
+  our_list_first = our_list_first;
+  ExpectListEq(our_list_first, {1, 2, 3});
+  our_list_second = std::move(our_moved);
+  ExpectListEq(our_list_second, {4});
+  EXPECT_TRUE(our_moved.empty());
+  our_moved.push_front(5);
+  ExpectListEq(our_moved, {5});
+}
+
 TEST(List, Merge1) {
   rpc::list<int> our_list_first = {2, 9};
   rpc::list<int> our_list_second = {1, 2, 3, 4, 5};
@@ -302,6 +487,65 @@ TEST(List, Reverse2) {
   EXPECT_EQ(our_list.back(), std_list.back());
 }
 
+TEST(List, Reverse_Relinks) {
+  for (int n = 0; n < 6; ++n) {
+    rpc::list<int> our_list;
+    std::list<int> std_list;
+    for (int i = 0; i < n; ++i) {
+      our_list.push_back(i);
+      std_list.push_back(i);
+    }
+    our_list.reverse();
+    std_list.reverse();
+    ExpectListEq(our_list, std_list);
+    our_list.push_front(-1);
+    our_list.push_back(n);
+    EXPECT_EQ(our_list.front(), -1);
+    EXPECT_EQ(our_list.back(), n);
+  }
+  rpc::list<CopyCounted> our_list_counted = {1, 2, 3, 4};
+  CopyCounted::copies = 0;
+  our_list_counted.reverse();
+  EXPECT_EQ(CopyCounted::copies, 0);
+  EXPECT_EQ(our_list_counted.front().value, 4);
+  EXPECT_EQ(our_list_counted.back().value, 1);
+}
+
+TEST(List, Merge_Compare) {
+  rpc::list<int> our_list_first = {9, 5, 5, 1};
+  rpc::list<int> our_list_second = {8, 5, 2, 0};
+  std::list<int> std_list_first = {9, 5, 5, 1};
+  std::list<int> std_list_second = {8, 5, 2, 0};
+  our_list_first.merge(our_list_second, std::greater<int>());
+  std_list_first.merge(std_list_second, std::greater<int>());
+  ExpectListEq(our_list_first, std_list_first);
+  EXPECT_TRUE(our_list_second.empty());
+  our_list_first.merge(rpc::list<int>{10, -1}, std::greater<int>());
+  EXPECT_EQ(our_list_first.front(), 10);
+  EXPECT_EQ(our_list_first.back(), -1);
+  EXPECT_EQ(our_list_first.size(), 10U);
+}
+
+TEST(List, Merge_Stable_No_Copies) {
+  rpc::list<CopyCounted> our_list_first = {1, 3, 5};
+  rpc::list<CopyCounted> our_list_second = {1, 3, 4};
+  const CopyCounted* first_one = &*our_list_first.begin();
+  const CopyCounted* second_one = &*our_list_second.begin();
+  CopyCounted::copies = 0;
+  our_list_first.merge(our_list_second);
+  EXPECT_EQ(CopyCounted::copies, 0);
+  auto it = our_list_first.begin();
+  EXPECT_EQ(&*it, first_one);
+  EXPECT_EQ(&*++it, second_one);
+  int expected[] = {1, 1, 3, 3, 4, 5};
+  it = our_list_first.begin();
+  for (int value : expected) {
+    EXPECT_EQ((*it).value, value);
+    ++it;
+  }
+  EXPECT_EQ(our_list_first.back().value, 5);
+}
+
 TEST(List, Unique) {
   rpc::list<int> our_list = {1, 2, 2, 3, 3};
   std::list<int> std_list = {1, 2, 2, 3, 3};
@@ -344,6 +588,45 @@ TEST(List, Sort) {
   EXPECT_EQ(*our_it, *std_it);
 }
 
+TEST(List, Sort_Compare_Stable) {
+  rpc::list<std::pair<int, int>> our_list = {{2, 0}, {1, 1}, {2, 2}, {1, 3},
+                                             {3, 4}, {2, 5}, {1, 6}};
+  std::list<std::pair<int, int>> std_list = {{2, 0}, {1, 1}, {2, 2}, {1, 3},
+                                             {3, 4}, {2, 5}, {1, 6}};
+  auto comp = [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+    return a.first > b.first;
+  };
+  our_list.sort(comp);
+  std_list.sort(comp);
+  auto our_it = our_list.begin();
+  for (auto std_it = std_list.begin(); std_it != std_list.end();
+       ++std_it, ++our_it) {
+    EXPECT_EQ(*our_it, *std_it);
+  }
+  EXPECT_EQ(our_list.back(), std_list.back());
+}
+
+TEST(List, Sort_Large) {
+  rpc::list<int> our_list;
+  std::list<int> std_list;
+  // value = (i * 7919) % 1000003, accumulated so that it never overflows int
+  int value = 0;
+  for (int i = 0; i < 1000000; ++i) {
+    our_list.push_back(value);
+    std_list.push_back(value);
+    value = (value + 7919) % 1000003;
+  }
+  our_list.sort();
+  std_list.sort();
+  auto std_it = std_list.begin();
+  for (auto our_it = our_list.begin(); our_it != our_list.end();
+       ++our_it, ++std_it) {
+    ASSERT_EQ(*our_it, *std_it);
+  }
+  EXPECT_EQ(our_list.size(), std_list.size());
+  EXPECT_EQ(*--our_list.end(), std_list.back());
+}
+
 TEST(List, Insert_Many) {
   rpc::list<int> our_list = {1, 2, 3, 4, 5};
   rpc::list<int>::iterator our_it = our_list.begin();
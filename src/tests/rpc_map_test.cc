@@ -319,4 +319,93 @@ TEST(map, insert_many_4) {
   EXPECT_EQ(result[0].second, false);
   EXPECT_EQ(map.size(), 1);
   EXPECT_EQ(map.at('f'), "five");
-}
\ No newline at end of file
+}
+TEST(map, balance_sorted_insert) {
+  rpc::map<int, int> map;
+  const int n = 100000;
+  for (int i = 0; i < n; ++i) {
+    map.insert(i, i);
+  }
+  for (int i = 0; i < n; i += 2) {
+    map.erase(map.find(i));
+  }
+  EXPECT_EQ(map.size(), static_cast<size_t>(n / 2));
+  size_t max_depth = 0;
+  int expected = 1;
+  for (auto it = map.begin(); it != map.end(); ++it, expected += 2) {
+    ASSERT_EQ(it.m_node->key, expected);
+    if (it.m_node->red && it.m_node->parent) {
+      ASSERT_FALSE(it.m_node->parent->red);
+    }
+    size_t depth = 0;
+    for (auto node = it.m_node; node; node = node->parent) ++depth;
+    if (depth > max_depth) max_depth = depth;
+  }
+  // высота красно-черного дерева не превышает 2 * log2(n + 1)
+  EXPECT_LE(max_depth, 2 * 16U);
+}
+TEST(map, copy_large) {
+  rpc::map<int, int> map;
+  const int n = 200000;
+  for (int i = 0; i < n; ++i) {
+    map[i] = -i;
+  }
+  rpc::map<int, int> copy(map);
+  EXPECT_EQ(copy.size(), map.size());
+  auto it_copy = copy.begin();
+  for (auto it = map.begin(); it != map.end(); ++it, ++it_copy) {
+    ASSERT_NE(it.m_node, it_copy.m_node);
+    ASSERT_EQ(it.m_node->key, it_copy.m_node->key);
+    ASSERT_EQ(it.m_node->data, it_copy.m_node->data);
+    ASSERT_EQ(it.m_node->red, it_copy.m_node->red);
+  }
+  EXPECT_EQ(it_copy, copy.end());
+}
+TEST(map, clear_reuse) {
+  rpc::map<int, int> map{{1, 1}, {2, 2}, {3, 3}};
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  map[4] = 4;
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at(4), 4);
+}
+TEST(map, move_assign) {
+  rpc::map<int, int> map{{1, 1}, {2, 2}};
+  rpc::map<int, int> other{{3, 3}};
+  map = std::move(other);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at(3), 3);
+  EXPECT_TRUE(other.empty());
+}
+namespace {
+struct CopyBomb {
+  static int alive;
+  static int copies_left;
+  int value = 0;
+  CopyBomb() { ++alive; }
+  CopyBomb(const CopyBomb &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++alive;
+  }
+  ~CopyBomb() { --alive; }
+};
+int CopyBomb::alive = 0;
+int CopyBomb::copies_left = -1;
+}  // namespace
+TEST(map, copy_throw_frees_nodes) {
+  {
+    using bomb_map = rpc::map<int, CopyBomb>;
+    bomb_map map;
+    for (int i = 0; i < 100; ++i) map[i].value = i;
+    ASSERT_EQ(CopyBomb::alive, 100);
+    CopyBomb::copies_left = 50;
+    EXPECT_THROW(bomb_map{map}, std::runtime_error);
+    CopyBomb::copies_left = -1;
+    EXPECT_EQ(CopyBomb::alive, 100);
+    bomb_map copy(map);
+    EXPECT_EQ(copy.size(), 100U);
+    EXPECT_EQ(copy.at(99).value, 99);
+  }
+  EXPECT_EQ(CopyBomb::alive, 0);
+}
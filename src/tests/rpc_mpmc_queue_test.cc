@@ -0,0 +1,93 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rpc_test.h"
+
+TEST(mpmc_queue, push_pop) {
+  rpc::mpmc_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 4);
+  EXPECT_TRUE(queue.empty());
+  queue.push("one");
+  queue.push(std::string("two"));
+  EXPECT_EQ(queue.size(), 2);
+  std::string value;
+  queue.pop(value);
+  EXPECT_EQ(value, "one");
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, "two");
+  EXPECT_FALSE(queue.try_pop(value));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpmc_queue, try_push_full) {
+  rpc::mpmc_queue<int> queue(4);
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(i));
+    EXPECT_FALSE(queue.try_push(4));
+    EXPECT_EQ(queue.size(), 4);
+    int value;
+    for (int i = 0; i < 4; ++i) {
+      EXPECT_TRUE(queue.try_pop(value));
+      EXPECT_EQ(value, i);
+    }
+  }
+}
+
+TEST(mpmc_queue, emplace_and_destroy) {
+  auto value = std::make_shared<int>(7);
+  {
+    rpc::mpmc_queue<std::shared_ptr<int>> queue(8);
+    EXPECT_TRUE(queue.try_emplace(value));
+    EXPECT_TRUE(queue.try_push(value));
+    std::shared_ptr<int> out;
+    queue.pop(out);
+    EXPECT_EQ(*out, 7);
+    EXPECT_EQ(value.use_count(), 3);
+  }
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+// Каждый производитель кладет свои номера по возрастанию. Все номера должны
+// дойти ровно один раз, а номера одного производителя - в порядке отправки
+TEST(mpmc_queue, stress) {
+  const int producers = 4, consumers = 4, per_producer = 50000;
+  rpc::mpmc_queue<int> queue(64);
+  std::vector<std::vector<int>> received(consumers);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < per_producer; ++i) {
+        queue.push(p * per_producer + i);
+      }
+    });
+  }
+  std::atomic<int> remaining{producers * per_producer};
+  for (int k = 0; k < consumers; ++k) {
+    threads.emplace_back([&queue, &received, &remaining, k] {
+      int value;
+      while (remaining.load() > 0) {
+        if (queue.try_pop(value)) {
+          received[k].push_back(value);
+          remaining.fetch_sub(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  std::vector<int> seen(producers * per_producer, 0);
+  for (const std::vector<int> &values : received) {
+    std::vector<int> last(producers, -1);
+    for (int value : values) {
+      ++seen[value];
+      int p = value / per_producer;
+      EXPECT_LT(last[p], value);
+      last[p] = value;
+    }
+  }
+  for (int count : seen) ASSERT_EQ(count, 1);
+  EXPECT_TRUE(queue.empty());
+}
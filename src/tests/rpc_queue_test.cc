@@ -257,4 +257,35 @@ TEST(queue_exceptions, case10_exceptions) {
   EXPECT_THROW(q.pop(), std::invalid_argument);
   EXPECT_THROW(q.front(), std::invalid_argument);
   EXPECT_THROW(q.back(), std::invalid_argument);
-}
\ No newline at end of file
+}
+TEST(queue_modifiers, case11_ring_wraparound) {
+  rpc::queue<std::string> rpc_q11;
+  std::queue<std::string> std_q11;
+  for (int i = 0; i < 1000; ++i) {
+    rpc_q11.push(std::to_string(i));
+    std_q11.push(std::to_string(i));
+    if (i % 3 == 1) {
+      rpc_q11.pop();
+      std_q11.pop();
+    }
+    ASSERT_EQ(rpc_q11.front(), std_q11.front());
+    ASSERT_EQ(rpc_q11.back(), std_q11.back());
+  }
+  rpc::queue<std::string> rpc_q11_copy(rpc_q11);
+  EXPECT_EQ(rpc_q11_copy.size(), std_q11.size());
+  while (!std_q11.empty()) {
+    ASSERT_EQ(rpc_q11_copy.front(), std_q11.front());
+    rpc_q11_copy.pop();
+    std_q11.pop();
+  }
+  EXPECT_TRUE(rpc_q11_copy.empty());
+}
+
+TEST(queue_modifiers, case12_push_own_element) {
+  rpc::queue<std::string> rpc_q12;
+  for (int i = 0; i < 8; ++i) rpc_q12.push(std::to_string(i));
+  rpc_q12.push(rpc_q12.front());
+  rpc_q12.push(rpc_q12.back());
+  EXPECT_EQ(rpc_q12.size(), 10);
+  EXPECT_EQ(rpc_q12.back(), "0");
+}
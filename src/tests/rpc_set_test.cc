@@ -1,3 +1,4 @@
+#include <cmath>
 #include <set>
 
 #include "rpc_test.h"
@@ -276,6 +277,68 @@ TEST(set_balance, case3) {
   EXPECT_EQ(rpc_set.size(), 5U);
 }
 
+TEST(set_balance, case4) {
+  const int n = 1000000;
+  rpc::set<int> rpc_set;
+  for (int i = 0; i < n; ++i) rpc_set.insert(i);
+
+  size_t max_depth = 0;
+  int expected = 0;
+  for (auto it = rpc_set.begin(); it != rpc_set.end(); ++it, ++expected) {
+    ASSERT_EQ(*it, expected);
+    size_t depth = 0;
+    for (auto node = it.get_node(); node; node = node->_parent) ++depth;
+    if (depth > max_depth) max_depth = depth;
+  }
+  EXPECT_EQ(rpc_set.size(), static_cast<size_t>(n));
+  EXPECT_LE(max_depth, 1.44 * std::log2(n + 2));
+}
+
+TEST(set_balance, case5) {
+  rpc::set<int> rpc_set;
+  for (int i = 0; i < 10000; ++i) rpc_set.insert(i);
+  for (int i = 0; i < 10000; i += 3) rpc_set.erase(rpc_set.find(i));
+
+  size_t max_depth = 0;
+  for (auto it = rpc_set.begin(); it != rpc_set.end(); ++it) {
+    size_t depth = 0;
+    for (auto node = it.get_node(); node; node = node->_parent) ++depth;
+    if (depth > max_depth) max_depth = depth;
+  }
+  EXPECT_EQ(rpc_set.size(), 6666U);
+  EXPECT_LE(max_depth, 1.44 * std::log2(rpc_set.size() + 2));
+}
+
+TEST(set_merge, case1) {
+  rpc::set<int> rpc_set = {1, 3, 5};
+  rpc::set<int> other = {2, 3, 4};
+  rpc_set.merge(other);
+
+  EXPECT_EQ(rpc_set.size(), 5U);
+  EXPECT_EQ(other.size(), 1U);
+  EXPECT_TRUE(other.contains(3));
+  int expected = 1;
+  for (auto it = rpc_set.begin(); it != rpc_set.end(); ++it, ++expected)
+    EXPECT_EQ(*it, expected);
+}
+
+TEST(set_constructor, copy_large) {
+  rpc::set<int> rpc_set;
+  for (int i = 0; i < 200000; ++i) rpc_set.insert(i);
+  rpc::set<int> rpc_copy(rpc_set);
+
+  EXPECT_EQ(rpc_copy.size(), rpc_set.size());
+  auto it_copy = rpc_copy.begin();
+  for (auto it = rpc_set.begin(); it != rpc_set.end(); ++it, ++it_copy) {
+    ASSERT_NE(it.get_node(), it_copy.get_node());
+    ASSERT_EQ(*it, *it_copy);
+    ASSERT_EQ(it.get_node()->_height, it_copy.get_node()->_height);
+  }
+  rpc_copy.clear();
+  EXPECT_TRUE(rpc_copy.empty());
+  EXPECT_EQ(rpc_set.size(), 200000U);
+}
+
 TEST(set_erase, case1) {
   rpc::set<int> rpc_set = {10, 5, 15, 4, 18, 13, 16};
 
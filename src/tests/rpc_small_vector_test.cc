@@ -0,0 +1,136 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "rpc_test.h"
+
+TEST(small_vector, inline_then_heap) {
+  rpc::small_vector<int, 4> vector;
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 4U);
+  for (int i = 0; i < 4; ++i) vector.push_back(i);
+  EXPECT_TRUE(vector.is_inline());
+  vector.push_back(4);
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 8U);
+  EXPECT_EQ(vector.size(), 5U);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(vector[i], i);
+
+  vector.erase(vector.cbegin() + 1, vector.cend());
+  vector.shrink_to_fit();
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 4U);
+  EXPECT_EQ(vector.back(), 0);
+  EXPECT_THROW(vector.at(1), std::out_of_range);
+}
+
+TEST(small_vector, copy_and_move) {
+  rpc::small_vector<std::string, 2> small{"a", "b"};
+  rpc::small_vector<std::string, 2> large{"a", "b", "c"};
+
+  rpc::small_vector<std::string, 2> small_copy(small);
+  rpc::small_vector<std::string, 2> large_copy(large);
+  EXPECT_TRUE(small_copy.is_inline());
+  EXPECT_EQ(large_copy.size(), 3U);
+  EXPECT_EQ(large_copy[2], "c");
+
+  const std::string *heap = large.data();
+  rpc::small_vector<std::string, 2> large_moved(std::move(large));
+  EXPECT_EQ(large_moved.data(), heap);
+  EXPECT_TRUE(large.empty());
+  EXPECT_TRUE(large.is_inline());
+
+  rpc::small_vector<std::string, 2> small_moved(std::move(small));
+  EXPECT_TRUE(small_moved.is_inline());
+  EXPECT_EQ(small_moved[1], "b");
+  EXPECT_TRUE(small.empty());
+
+  small_moved.swap(large_moved);
+  EXPECT_EQ(small_moved.size(), 3U);
+  EXPECT_EQ(large_moved.size(), 2U);
+  EXPECT_EQ(large_moved[0], "a");
+
+  large_moved = large_copy;
+  EXPECT_EQ(large_moved.size(), 3U);
+  large_moved = std::move(small_copy);
+  EXPECT_EQ(large_moved.size(), 2U);
+  EXPECT_EQ(large_moved[1], "b");
+}
+
+TEST(small_vector, insert_erase) {
+  rpc::small_vector<int, 8> vector{1, 2, 3, 7, 8};
+  vector.insert_many(vector.cbegin() + 3, 4, 5, 6);
+  vector.insert_many_back(9, 10);
+  EXPECT_EQ(vector.size(), 10U);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(vector[i], i + 1);
+
+  vector.insert(vector.cbegin(), 0);
+  vector.emplace(vector.cend(), 11);
+  EXPECT_EQ(vector.front(), 0);
+  EXPECT_EQ(vector.back(), 11);
+  vector.erase(vector.cbegin());
+  EXPECT_EQ(vector.front(), 1);
+
+  std::vector<int> source{-1, -2};
+  vector.insert(vector.cbegin() + 1, source.begin(), source.end());
+  EXPECT_EQ(vector[1], -1);
+  EXPECT_EQ(vector[3], 2);
+
+  rpc::small_vector<int, 8> from_range(rpc::from_range, source);
+  from_range.assign({5, 6, 7});
+  EXPECT_EQ(from_range.size(), 3U);
+  EXPECT_EQ(from_range[0], 5);
+
+  long long sum = 0;
+  for (int value : vector) sum += value;
+  EXPECT_EQ(sum, 66 - 3);
+  rpc::small_vector<int, 8>::VectorIterator it(vector.begin());
+  EXPECT_EQ(*++it, -1);
+}
+
+TEST(small_vector, no_default_constructor) {
+  struct Value {
+    explicit Value(int v) : value(std::make_unique<int>(v)) {}
+    std::unique_ptr<int> value;
+  };
+  rpc::small_vector<Value, 2> vector;
+  for (int i = 0; i < 5; ++i) vector.emplace_back(i);
+  vector.erase(vector.cbegin() + 1);
+  EXPECT_EQ(*vector[1].value, 2);
+  rpc::small_vector<Value, 2> moved(std::move(vector));
+  EXPECT_EQ(moved.size(), 4U);
+  EXPECT_EQ(*moved[3].value, 4);
+}
+
+TEST(small_vector, growth_policy_and_stats) {
+  rpc::small_vector<int, 4, std::allocator<int>, rpc::fixed_growth<3>> vector;
+  for (int i = 0; i < 4; ++i) vector.push_back(i);
+  EXPECT_EQ(vector.stats().reallocs, 0U);
+  vector.push_back(4);
+  EXPECT_EQ(vector.capacity(), 7U);
+  for (int i = 5; i < 10; ++i) vector.push_back(i);
+  EXPECT_EQ(vector.capacity(), 10U);
+  EXPECT_EQ(vector.stats().reallocs, 2U);
+  EXPECT_EQ(vector.stats().bytes_copied, (4 + 7) * sizeof(int));
+
+  vector.erase(vector.cbegin() + 2, vector.cend());
+  vector.shrink_to_fit();
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.stats().reallocs, 3U);
+
+  decltype(vector) moved(std::move(vector));
+  EXPECT_EQ(moved.stats().reallocs, 3U);
+  EXPECT_EQ(vector.stats().reallocs, 0U);
+}
+
+TEST(small_vector, erase_empty_range) {
+  rpc::small_vector<int, 4> vector;
+  EXPECT_EQ(vector.erase(vector.cbegin(), vector.cbegin()), vector.begin());
+  EXPECT_THROW(vector.erase(vector.cbegin()), std::out_of_range);
+  vector.assign({1, 2, 3});
+  EXPECT_EQ(vector.erase(vector.cbegin() + 1, vector.cbegin() + 1),
+            vector.begin() + 1);
+  EXPECT_EQ(vector.size(), 3U);
+  EXPECT_THROW(vector.erase(vector.cend(), vector.cbegin()),
+               std::out_of_range);
+}
@@ -0,0 +1,96 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rpc_test.h"
+
+TEST(spsc_queue, push_pop) {
+  rpc::spsc_queue<std::string, 4> queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.capacity(), 4);
+  queue.push("one");
+  queue.push("two");
+  EXPECT_EQ(queue.size(), 2);
+  EXPECT_EQ(queue.front(), "one");
+  queue.pop();
+  EXPECT_EQ(queue.front(), "two");
+  queue.pop();
+  EXPECT_TRUE(queue.empty());
+  EXPECT_THROW(queue.front(), std::invalid_argument);
+  EXPECT_THROW(queue.pop(), std::invalid_argument);
+}
+
+TEST(spsc_queue, try_push_full) {
+  rpc::spsc_queue<int, 4> queue;
+  for (int i = 0; i < 4; ++i) EXPECT_TRUE(queue.try_push(i));
+  EXPECT_FALSE(queue.try_push(4));
+  int value = -1;
+  EXPECT_TRUE(queue.try_pop(value));
+  EXPECT_EQ(value, 0);
+  EXPECT_TRUE(queue.try_push(4));
+  for (int i = 1; i <= 4; ++i) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.try_pop(value));
+}
+
+TEST(spsc_queue, batch) {
+  rpc::spsc_queue<std::string, 8> queue;
+  std::vector<std::string> input{"a", "b", "c", "d", "e", "f"};
+  EXPECT_EQ(queue.push_n(input.begin(), input.size()), 6);
+  EXPECT_EQ(queue.push_n(input.begin(), input.size()), 2);
+  std::vector<std::string> output(10);
+  EXPECT_EQ(queue.pop_n(output.begin(), 3), 3);
+  EXPECT_EQ(output[2], "c");
+  EXPECT_EQ(queue.pop_n(output.begin(), 10), 5);
+  EXPECT_EQ(output[2], "f");
+  EXPECT_EQ(output[3], "a");
+  EXPECT_EQ(output[4], "b");
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.pop_n(output.begin(), 10), 0);
+}
+
+TEST(spsc_queue, destroys_remaining) {
+  auto value = std::make_shared<int>(1);
+  {
+    rpc::spsc_queue<std::shared_ptr<int>, 4> queue;
+    for (int i = 0; i < 6; ++i) {
+      queue.try_push(value);
+      if (i % 2) queue.pop();
+    }
+    EXPECT_EQ(value.use_count(), 1 + static_cast<long>(queue.size()));
+  }
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(spsc_queue, two_threads) {
+  const int n = 200000;
+  rpc::spsc_queue<int, 64> queue;
+  std::thread producer([&] {
+    int batch[7];
+    for (int i = 0; i < n;) {
+      if (i % 3) {
+        queue.push(i++);
+      } else {
+        int count = std::min(7, n - i);
+        for (int k = 0; k < count; ++k) batch[k] = i + k;
+        i += static_cast<int>(queue.push_n(batch, count));
+      }
+    }
+  });
+  int expected = 0;
+  int batch[5];
+  while (expected < n) {
+    size_t count = queue.pop_n(batch, 5);
+    for (size_t k = 0; k < count; ++k) ASSERT_EQ(batch[k], expected++);
+    int value;
+    if (queue.try_pop(value)) {
+      ASSERT_EQ(value, expected++);
+    }
+    if (!count) std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_TRUE(queue.empty());
+}
@@ -168,4 +168,45 @@ TEST(Stack, InsertManyBack2) {
   rpc::stack<int> our_stack_int;
   our_stack_int.insert_many_back(-1, 4, 5, 6, 7, 4, 6);
   EXPECT_EQ(our_stack_int.top(), 6);
-}
\ No newline at end of file
+}
+TEST(Stack, SizeCached) {
+  rpc::stack<std::string> our_stack;
+  std::stack<std::string> std_stack;
+  for (int i = 0; i < 100; ++i) {
+    our_stack.push(std::to_string(i));
+    std_stack.push(std::to_string(i));
+    EXPECT_EQ(our_stack.size(), std_stack.size());
+  }
+  our_stack.pop();
+  std_stack.pop();
+  EXPECT_EQ(our_stack.size(), std_stack.size());
+  EXPECT_EQ(our_stack.top(), std_stack.top());
+}
+
+TEST(Stack, ListContainer) {
+  rpc::list<int> list = {1, 2, 3};
+  rpc::stack<int, rpc::list<int>> our_stack(list);
+  static_assert(std::is_same_v<decltype(our_stack)::allocator_type,
+                               rpc::list<int>::allocator_type>);
+  EXPECT_EQ(our_stack.size(), 3);
+  EXPECT_EQ(our_stack.top(), 3);
+  our_stack.push(4);
+  EXPECT_EQ(our_stack.top(), 4);
+  our_stack.pop();
+  our_stack.pop();
+  EXPECT_EQ(our_stack.top(), 2);
+  EXPECT_EQ(our_stack.size(), 2);
+}
+
+TEST(Stack, Allocator) {
+  rpc::stack<int, rpc::vector<int, rpc::pool_allocator<int>>> our_stack = {
+      1, 2, 3};
+  static_assert(std::is_same_v<decltype(our_stack)::allocator_type,
+                               rpc::pool_allocator<int>>);
+  our_stack.push(4);
+  EXPECT_EQ(our_stack.top(), 4);
+  EXPECT_EQ(our_stack.size(), 4);
+  rpc::stack<int, rpc::vector<int, std::allocator<int>>> std_alloc_stack;
+  std_alloc_stack.push(1);
+  EXPECT_EQ(std_alloc_stack.top(), 1);
+}
@@ -0,0 +1,168 @@
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "rpc_test.h"
+
+namespace {
+
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view value) const {
+    return std::hash<std::string_view>()(value);
+  }
+};
+
+}  // namespace
+
+TEST(unordered_map, def_constructor) {
+  rpc::unordered_map<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.find(1), map.end());
+}
+TEST(unordered_map, init_list) {
+  rpc::unordered_map<int, std::string> map{{1, "one"}, {2, "two"}, {1, "x"}};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_EQ(map.at(2), "two");
+}
+TEST(unordered_map, at) {
+  rpc::unordered_map<int, int> map{{1, 10}};
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_THROW(map.at(2), std::out_of_range);
+  const rpc::unordered_map<int, int> &ref = map;
+  EXPECT_EQ(ref.at(1), 10);
+}
+TEST(unordered_map, operator_brackets) {
+  rpc::unordered_map<std::string, int> map;
+  map["a"] = 1;
+  map["b"] += 2;
+  map["a"] += 5;
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map["a"], 6);
+  EXPECT_EQ(map["b"], 2);
+}
+TEST(unordered_map, insert) {
+  rpc::unordered_map<int, std::string> map;
+  auto result = map.insert(std::make_pair(1, "one"));
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(result.first->first, 1);
+  result = map.insert(1, "uno");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, "one");
+  EXPECT_EQ(map.size(), 1);
+}
+TEST(unordered_map, insert_or_assign) {
+  rpc::unordered_map<int, std::string> map;
+  EXPECT_TRUE(map.insert_or_assign(5, "five").second);
+  auto result = map.insert_or_assign(5, "new five");
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, "new five");
+  EXPECT_EQ(map.size(), 1);
+}
+TEST(unordered_map, erase) {
+  rpc::unordered_map<int, int> map{{1, 1}, {2, 2}, {3, 3}};
+  map.erase(map.find(2));
+  EXPECT_EQ(map.erase(3), 1);
+  EXPECT_EQ(map.erase(3), 0);
+  map.erase(map.end());
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(2));
+}
+TEST(unordered_map, merge) {
+  rpc::unordered_map<int, int> map{{1, 1}, {2, 2}};
+  rpc::unordered_map<int, int> other{{2, 20}, {3, 30}};
+  map.merge(other);
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at(2), 2);
+  EXPECT_EQ(map.at(3), 30);
+  EXPECT_EQ(other.size(), 1);
+  EXPECT_EQ(other.at(2), 20);
+}
+TEST(unordered_map, insert_many) {
+  rpc::unordered_map<int, char> map{{1, 'a'}};
+  auto result = map.insert_many(std::make_pair(1, 'x'), std::make_pair(2, 'b'),
+                                std::make_pair(3, 'c'));
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_FALSE(result[0].second);
+  EXPECT_EQ(result[0].first->second, 'a');
+  EXPECT_TRUE(result[1].second);
+  EXPECT_EQ(result[1].first->second, 'b');
+  EXPECT_EQ(result[2].first->first, 3);
+  EXPECT_EQ(map.size(), 3);
+}
+TEST(unordered_map, heterogeneous_lookup) {
+  rpc::unordered_map<std::string, int, StringHash, std::equal_to<>> map;
+  map["apple"] = 1;
+  std::string_view key = "apple";
+  EXPECT_TRUE(map.contains(key));
+  EXPECT_TRUE(map.contains("apple"));
+  EXPECT_FALSE(map.contains("pear"));
+  EXPECT_EQ(map.at(key), 1);
+  EXPECT_EQ(map.find(key)->second, 1);
+}
+TEST(unordered_map, reserve) {
+  rpc::unordered_map<int, int> map;
+  map.reserve(1000);
+  size_t buckets = map.bucket_count();
+  EXPECT_GE(buckets, 1000);
+  map[0] = 0;
+  int *first = &map[0];
+  for (int i = 1; i < 1000; ++i) map[i] = i;
+  EXPECT_EQ(map.bucket_count(), buckets);
+  EXPECT_EQ(first, &map[0]);
+  EXPECT_LE(map.load_factor(), 1.0f);
+}
+TEST(unordered_map, copy_and_move) {
+  rpc::unordered_map<int, std::string> map;
+  for (int i = 0; i < 100; ++i) map[i] = std::to_string(i);
+  for (int i = 0; i < 100; i += 2) map.erase(i);
+  rpc::unordered_map<int, std::string> copy(map);
+  EXPECT_EQ(copy.size(), 50);
+  for (int i = 1; i < 100; i += 2) EXPECT_EQ(copy.at(i), std::to_string(i));
+  EXPECT_FALSE(copy.contains(0));
+  rpc::unordered_map<int, std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 50);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy.size(), 50);
+  moved = rpc::unordered_map<int, std::string>{{7, "seven"}};
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved.at(7), "seven");
+}
+TEST(unordered_map, clear_reuse) {
+  rpc::unordered_map<int, int> map{{1, 1}, {2, 2}};
+  size_t buckets = map.bucket_count();
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.bucket_count(), buckets);
+  map[3] = 3;
+  EXPECT_EQ(map.size(), 1);
+}
+TEST(unordered_map, random_ops_match_std) {
+  rpc::unordered_map<int, int> map;
+  std::unordered_map<int, int> expected;
+  unsigned state = 1;
+  for (int i = 0; i < 200000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int key = static_cast<int>((state >> 8) % 4096);
+    if ((state >> 4) % 3) {
+      map[key] += i;
+      expected[key] += i;
+    } else {
+      ASSERT_EQ(map.erase(key), expected.erase(key));
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  size_t visited = 0;
+  for (const auto &item : map) {
+    ASSERT_EQ(expected.at(item.first), item.second);
+    ++visited;
+  }
+  EXPECT_EQ(visited, expected.size());
+}
@@ -0,0 +1,138 @@
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+#include "rpc_test.h"
+
+namespace {
+
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view value) const {
+    return std::hash<std::string_view>()(value);
+  }
+};
+
+}  // namespace
+
+TEST(unordered_set, def_constructor) {
+  rpc::unordered_set<int> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.size(), 0);
+  EXPECT_EQ(set.begin(), set.end());
+  EXPECT_FALSE(set.contains(1));
+  EXPECT_EQ(set.find(1), set.end());
+}
+TEST(unordered_set, init_list) {
+  rpc::unordered_set<std::string> set{"one", "two", "one"};
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains("one"));
+  EXPECT_TRUE(set.contains("two"));
+}
+TEST(unordered_set, insert) {
+  rpc::unordered_set<int> set;
+  auto result = set.insert(1);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, 1);
+  result = set.insert(1);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(*result.first, 1);
+  EXPECT_EQ(set.size(), 1);
+}
+TEST(unordered_set, erase) {
+  rpc::unordered_set<int> set{1, 2, 3};
+  set.erase(set.find(2));
+  EXPECT_EQ(set.erase(3), 1);
+  EXPECT_EQ(set.erase(3), 0);
+  set.erase(set.end());
+  EXPECT_EQ(set.size(), 1);
+  EXPECT_TRUE(set.contains(1));
+  EXPECT_FALSE(set.contains(2));
+}
+TEST(unordered_set, merge) {
+  rpc::unordered_set<int> set{1, 2};
+  rpc::unordered_set<int> other{2, 3};
+  set.merge(other);
+  EXPECT_EQ(set.size(), 3);
+  EXPECT_TRUE(set.contains(3));
+  EXPECT_EQ(other.size(), 1);
+  EXPECT_TRUE(other.contains(2));
+}
+TEST(unordered_set, insert_many) {
+  rpc::unordered_set<int> set{1};
+  auto result = set.insert_many(1, 2, 3);
+  ASSERT_EQ(result.size(), 3);
+  EXPECT_FALSE(result[0].second);
+  EXPECT_TRUE(result[1].second);
+  EXPECT_EQ(*result[1].first, 2);
+  EXPECT_EQ(*result[2].first, 3);
+  EXPECT_EQ(set.size(), 3);
+}
+TEST(unordered_set, heterogeneous_lookup) {
+  rpc::unordered_set<std::string, StringHash, std::equal_to<>> set{"apple"};
+  std::string_view key = "apple";
+  EXPECT_TRUE(set.contains(key));
+  EXPECT_FALSE(set.contains("pear"));
+  EXPECT_EQ(*set.find(key), "apple");
+}
+TEST(unordered_set, reserve) {
+  rpc::unordered_set<int> set;
+  set.reserve(1000);
+  size_t buckets = set.bucket_count();
+  EXPECT_GE(buckets, 1000);
+  const int *first = &*set.insert(0).first;
+  for (int i = 1; i < 1000; ++i) set.insert(i);
+  EXPECT_EQ(set.bucket_count(), buckets);
+  EXPECT_EQ(first, &*set.find(0));
+  EXPECT_LE(set.load_factor(), 1.0f);
+}
+TEST(unordered_set, copy_and_move) {
+  rpc::unordered_set<std::string> set;
+  for (int i = 0; i < 100; ++i) set.insert(std::to_string(i));
+  for (int i = 0; i < 100; i += 2) set.erase(std::to_string(i));
+  rpc::unordered_set<std::string> copy(set);
+  EXPECT_EQ(copy.size(), 50);
+  for (int i = 1; i < 100; i += 2) {
+    EXPECT_TRUE(copy.contains(std::to_string(i)));
+  }
+  EXPECT_FALSE(copy.contains("0"));
+  rpc::unordered_set<std::string> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 50);
+  EXPECT_TRUE(copy.empty());
+  copy = moved;
+  EXPECT_EQ(copy.size(), 50);
+  moved = rpc::unordered_set<std::string>{"seven"};
+  EXPECT_EQ(moved.size(), 1);
+  EXPECT_TRUE(moved.contains("seven"));
+}
+TEST(unordered_set, clear_reuse) {
+  rpc::unordered_set<int> set{1, 2};
+  size_t buckets = set.bucket_count();
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+  EXPECT_EQ(set.bucket_count(), buckets);
+  set.insert(3);
+  EXPECT_EQ(set.size(), 1);
+}
+TEST(unordered_set, random_ops_match_std) {
+  rpc::unordered_set<int> set;
+  std::unordered_set<int> expected;
+  unsigned state = 1;
+  for (int i = 0; i < 200000; ++i) {
+    state = state * 1103515245u + 12345u;
+    int key = static_cast<int>((state >> 8) % 4096);
+    if ((state >> 4) % 3) {
+      ASSERT_EQ(set.insert(key).second, expected.insert(key).second);
+    } else {
+      ASSERT_EQ(set.erase(key), expected.erase(key));
+    }
+  }
+  ASSERT_EQ(set.size(), expected.size());
+  size_t visited = 0;
+  for (int key : set) {
+    ASSERT_EQ(expected.count(key), 1);
+    ++visited;
+  }
+  EXPECT_EQ(visited, expected.size());
+}
@@ -0,0 +1,182 @@
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+
+#include "rpc_test.h"
+
+namespace {
+
+// Маленький блок, чтобы тесты доходили до деления и слияния блоков
+template <typename T>
+using Unrolled = rpc::unrolled_list<T, 4>;
+
+// Проходит список в обе стороны и сравнивает с std::list
+template <typename T>
+void ExpectListEq(const Unrolled<T>& our_list, const std::list<T>& std_list) {
+  ASSERT_EQ(our_list.size(), std_list.size());
+  auto it = our_list.begin();
+  for (const T& value : std_list) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == our_list.end());
+  for (auto std_it = std_list.rbegin(); std_it != std_list.rend(); ++std_it) {
+    EXPECT_EQ(*--it, *std_it);
+  }
+  EXPECT_TRUE(it == our_list.begin());
+}
+
+}  // namespace
+
+TEST(unrolled_list, push_pop_fill_blocks) {
+  Unrolled<int> our_list;
+  std::list<int> std_list;
+  for (int i = 0; i < 10; ++i) {
+    our_list.push_back(i);
+    std_list.push_back(i);
+  }
+  // push_back заполняет блоки целиком
+  EXPECT_EQ(our_list.block_count(), 3U);
+  for (int i = 0; i < 3; ++i) {
+    our_list.push_front(-i);
+    std_list.push_front(-i);
+  }
+  ExpectListEq(our_list, std_list);
+  EXPECT_EQ(our_list.front(), -2);
+  EXPECT_EQ(our_list.back(), 9);
+  while (!std_list.empty()) {
+    our_list.pop_front();
+    std_list.pop_front();
+    if (std_list.empty()) break;
+    our_list.pop_back();
+    std_list.pop_back();
+    ExpectListEq(our_list, std_list);
+  }
+  EXPECT_TRUE(our_list.empty());
+  EXPECT_EQ(our_list.block_count(), 0U);
+  EXPECT_TRUE(our_list.begin() == our_list.end());
+}
+
+TEST(unrolled_list, insert_erase_random) {
+  Unrolled<std::string> our_list;
+  std::list<std::string> std_list;
+  std::mt19937 rng(7);
+  for (int step = 0; step < 2000; ++step) {
+    size_t index = std_list.empty() ? 0 : rng() % (std_list.size() + 1);
+    auto our_it = std::next(our_list.begin(), index);
+    auto std_it = std::next(std_list.begin(), index);
+    if (rng() % 3 != 0 || std_it == std_list.end()) {
+      std::string value = std::to_string(step);
+      EXPECT_EQ(*our_list.insert(our_it, value), value);
+      std_list.insert(std_it, value);
+    } else {
+      auto our_next = our_list.erase(our_it);
+      auto std_next = std_list.erase(std_it);
+      if (std_next != std_list.end()) {
+        EXPECT_EQ(*our_next, *std_next);
+      }
+      EXPECT_EQ(our_next == our_list.end(), std_next == std_list.end());
+    }
+  }
+  ExpectListEq(our_list, std_list);
+  // блоки не вырождаются: соседние блоки, вместе занятые не больше чем
+  // наполовину, сливаются при удалении
+  EXPECT_LE(3 * our_list.block_count(), 2 * our_list.size() + 3);
+  EXPECT_THROW(our_list.erase(our_list.end()), std::logic_error);
+
+  our_list.erase(std::next(our_list.begin()), std::prev(our_list.end()));
+  std_list.erase(std::next(std_list.begin()), std::prev(std_list.end()));
+  ExpectListEq(our_list, std_list);
+}
+
+TEST(unrolled_list, insert_own_element) {
+  // вставка в полный блок делит его и переносит элементы: значение из того
+  // же списка должно копироваться до переноса
+  const std::string long_tail(32, 'z');
+  Unrolled<std::string> our_list{"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+                                 "bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb",
+                                 "cccccccccccccccccccccccccccccccc", long_tail};
+  std::list<std::string> std_list(our_list.begin(), our_list.end());
+  our_list.insert(our_list.cbegin(), our_list.back());
+  std_list.insert(std_list.begin(), std_list.back());
+  our_list.emplace(std::next(our_list.cbegin(), 2), our_list.front());
+  std_list.emplace(std::next(std_list.begin(), 2), std_list.front());
+  our_list.insert(our_list.cend(), our_list.front());
+  std_list.insert(std_list.end(), std_list.front());
+  EXPECT_EQ(our_list.front(), long_tail);
+  ExpectListEq(our_list, std_list);
+}
+
+TEST(unrolled_list, copy_move_swap) {
+  Unrolled<std::string> our_list{"a", "b", "c", "d", "e"};
+  Unrolled<std::string> our_copy(our_list);
+  ExpectListEq(our_copy, {"a", "b", "c", "d", "e"});
+  const std::string* first = &our_list.front();
+  Unrolled<std::string> our_moved(std::move(our_list));
+  EXPECT_TRUE(our_list.empty());
+  // перевешиваются блоки, элементы остаются на месте
+  EXPECT_EQ(&our_moved.front(), first);
+  our_list = our_copy;
+  our_list.push_back("f");
+  our_moved.swap(our_list);
+  EXPECT_EQ(our_moved.size(), 6U);
+  EXPECT_EQ(our_list.size(), 5U);
+  our_copy = std::move(our_moved);
+  ExpectListEq(our_copy, {"a", "b", "c", "d", "e", "f"});
+}
+
+TEST(unrolled_list, splice) {
+  Unrolled<int> our_first{1, 2, 3, 4, 5, 6};
+  Unrolled<int> our_second{7, 8, 9};
+  std::list<int> std_first{1, 2, 3, 4, 5, 6};
+  std::list<int> std_second{7, 8, 9};
+  // в середину блока: блок делится, блоки other перевешиваются
+  our_first.splice(std::next(our_first.begin(), 2), our_second);
+  std_first.splice(std::next(std_first.begin(), 2), std_second);
+  ExpectListEq(our_first, std_first);
+  EXPECT_TRUE(our_second.empty());
+
+  our_second.splice(our_second.end(), our_first, our_first.begin());
+  std_second.splice(std_second.end(), std_first, std_first.begin());
+  our_second.splice(our_second.begin(), our_first,
+                    std::next(our_first.begin(), 3),
+                    std::prev(our_first.end()));
+  std_second.splice(std_second.begin(), std_first,
+                    std::next(std_first.begin(), 3),
+                    std::prev(std_first.end()));
+  ExpectListEq(our_first, std_first);
+  ExpectListEq(our_second, std_second);
+
+  // внутри одного списка - вперед и назад
+  our_second.splice(our_second.end(), our_second, our_second.begin(),
+                    std::next(our_second.begin(), 2));
+  std_second.splice(std_second.end(), std_second, std_second.begin(),
+                    std::next(std_second.begin(), 2));
+  our_second.splice(our_second.begin(), our_second,
+                    std::prev(our_second.end()));
+  std_second.splice(std_second.begin(), std_second,
+                    std::prev(std_second.end()));
+  ExpectListEq(our_second, std_second);
+  EXPECT_THROW(our_first.splice(our_first.begin(), our_second,
+                                our_second.end()),
+               std::logic_error);
+}
+
+TEST(unrolled_list, block_size_one_and_default) {
+  rpc::unrolled_list<int, 1> our_single{2, 4};
+  our_single.insert(our_single.begin(), 1);
+  our_single.insert(std::next(our_single.begin(), 2), 3);
+  our_single.push_back(5);
+  EXPECT_EQ(our_single.block_count(), 5U);
+  int expected = 1;
+  for (int value : our_single) EXPECT_EQ(value, expected++);
+
+  rpc::unrolled_list<int> our_list;
+  for (int i = 0; i < 1000; ++i) our_list.push_back(i);
+  // блок по умолчанию ~512 байт: 128 int
+  EXPECT_EQ(our_list.block_count(), 8U);
+  long long sum = 0;
+  for (int value : our_list) sum += value;
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+}
@@ -1,3 +1,7 @@
+#include <iterator>
+#include <list>
+#include <memory>
+#include <sstream>
 #include <vector>
 
 #include "rpc_test.h"
@@ -278,6 +282,13 @@ TEST(vector_access, case8_brackets_opers) {
   EXPECT_EQ(s, "Red");
   EXPECT_EQ(rpc_v8_string[1], "Green");
   EXPECT_EQ(rpc_v8_string[2], "Blue");
+
+  const rpc::vector<std::string> &rpc_v8_const = rpc_v8_string;
+  EXPECT_EQ(rpc_v8_const[2], "Blue");
+  EXPECT_EQ(rpc_v8_const.at(1), "Green");
+  EXPECT_THROW(rpc_v8_const.at(3), std::out_of_range);
+  rpc_v8_string[0] = "Cyan";
+  EXPECT_EQ(rpc_v8_const[0], "Cyan");
 }
 
 TEST(vector_access, case9_data) {
@@ -678,11 +689,345 @@ TEST(vector_bonus, case24_insert_many_back) {
   }
 }
 
+namespace {
+
+// Тип без конструктора по умолчанию, считающий живые экземпляры
+struct Counted {
+  static int alive;
+  static int constructed;
+  int value;
+  explicit Counted(int v) : value(v) {
+    ++alive;
+    ++constructed;
+  }
+  Counted(const Counted &other) : value(other.value) {
+    ++alive;
+    ++constructed;
+  }
+  Counted(Counted &&other) noexcept : value(other.value) {
+    ++alive;
+    ++constructed;
+  }
+  Counted &operator=(const Counted &other) = default;
+  Counted &operator=(Counted &&other) = default;
+  ~Counted() { --alive; }
+};
+int Counted::alive = 0;
+int Counted::constructed = 0;
+
+}  // namespace
+
+TEST(vector_allocator, case25_no_default_constructor) {
+  Counted::alive = 0;
+  {
+    rpc::vector<Counted> rpc_v25;
+    for (int i = 0; i < 100; ++i) rpc_v25.push_back(Counted(i));
+    rpc_v25.reserve(1000);
+    EXPECT_EQ(Counted::alive, 100);
+    rpc_v25.insert(rpc_v25.begin(), Counted(-1));
+    rpc_v25.erase(rpc_v25.begin() + 50);
+    rpc_v25.pop_back();
+    EXPECT_EQ(Counted::alive, 99);
+    EXPECT_EQ(rpc_v25[0].value, -1);
+    EXPECT_EQ(rpc_v25[50].value, 50);
+    rpc_v25.shrink_to_fit();
+    EXPECT_EQ(rpc_v25.capacity(), 99U);
+    rpc_v25.clear();
+    EXPECT_EQ(Counted::alive, 0);
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(vector_allocator, case26_reserve_constructs_live_only) {
+  rpc::vector<Counted> rpc_v26;
+  for (int i = 0; i < 10; ++i) rpc_v26.push_back(Counted(i));
+  Counted::constructed = 0;
+  rpc_v26.reserve(1000000);
+  EXPECT_EQ(Counted::constructed, 10);
+  EXPECT_EQ(rpc_v26.capacity(), 1000000U);
+  EXPECT_EQ(rpc_v26[9].value, 9);
+}
+
+TEST(vector_allocator, case27_self_reference) {
+  rpc::vector<std::string> rpc_v27{"first"};
+  for (int i = 0; i < 10; ++i) rpc_v27.push_back(rpc_v27[0]);
+  rpc_v27.insert(rpc_v27.begin(), rpc_v27[5]);
+  EXPECT_EQ(rpc_v27.size(), 12U);
+  for (size_t i = 0; i < rpc_v27.size(); ++i) EXPECT_EQ(rpc_v27[i], "first");
+}
+
+TEST(vector_modifiers, case28_push_back_move) {
+  rpc::vector<std::string> rpc_v28;
+  std::string value(100, 'x');
+  rpc_v28.push_back(std::move(value));
+  EXPECT_TRUE(value.empty());
+  EXPECT_EQ(rpc_v28[0], std::string(100, 'x'));
+
+  rpc::vector<std::unique_ptr<int>> rpc_v28_ptr;
+  for (int i = 0; i < 100; ++i) rpc_v28_ptr.push_back(std::make_unique<int>(i));
+  rpc_v28_ptr.insert(rpc_v28_ptr.begin(), std::make_unique<int>(-1));
+  EXPECT_EQ(*rpc_v28_ptr[0], -1);
+  EXPECT_EQ(*rpc_v28_ptr[100], 99);
+}
+
+TEST(vector_modifiers, case29_emplace) {
+  rpc::vector<std::pair<int, std::string>> rpc_v29;
+  auto &ref = rpc_v29.emplace_back(1, "one");
+  EXPECT_EQ(ref.first, 1);
+  rpc_v29.emplace_back(3, "three");
+  auto it = rpc_v29.emplace(rpc_v29.cbegin() + 1, 2, "two");
+  EXPECT_EQ(it->second, "two");
+  rpc_v29.emplace(rpc_v29.cbegin(), 0, "zero");
+  rpc_v29.emplace(rpc_v29.cbegin() + rpc_v29.size(), 4, "four");
+  EXPECT_EQ(rpc_v29.size(), 5U);
+  for (size_t i = 0; i < rpc_v29.size(); ++i) {
+    EXPECT_EQ(rpc_v29[i].first, static_cast<int>(i));
+  }
+  EXPECT_THROW(rpc_v29.emplace(rpc_v29.cbegin() + 6, 6, "six"),
+               std::out_of_range);
+
+  Counted::constructed = 0;
+  rpc::vector<Counted> rpc_v29_counted;
+  rpc_v29_counted.reserve(4);
+  rpc_v29_counted.emplace_back(7);
+  EXPECT_EQ(Counted::constructed, 1);
+}
+
+TEST(vector_constructors, case30_range) {
+  std::vector<int> source{1, 2, 3, 4, 5};
+  rpc::vector<int> rpc_v30(source.begin(), source.end());
+  EXPECT_EQ(rpc_v30.size(), 5U);
+  EXPECT_EQ(rpc_v30.capacity(), 5U);
+  for (size_t i = 0; i < source.size(); ++i) EXPECT_EQ(rpc_v30[i], source[i]);
+
+  std::list<std::string> words{"a", "b", "c"};
+  rpc::vector<std::string> rpc_v30_str(rpc::from_range, words);
+  EXPECT_EQ(rpc_v30_str.size(), 3U);
+  EXPECT_EQ(rpc_v30_str[2], "c");
+
+  int array[] = {7, 8, 9};
+  rpc::vector<long> rpc_v30_long(rpc::from_range, array);
+  EXPECT_EQ(rpc_v30_long.size(), 3U);
+  EXPECT_EQ(rpc_v30_long[0], 7);
+
+  std::istringstream input("10 20 30");
+  rpc::vector<int> rpc_v30_input((std::istream_iterator<int>(input)),
+                                 std::istream_iterator<int>());
+  EXPECT_EQ(rpc_v30_input.size(), 3U);
+  EXPECT_EQ(rpc_v30_input[2], 30);
+}
+
+TEST(vector_modifiers, case31_insert_range) {
+  const int source[] = {-1, -2, -3};
+  // середина при свободной емкости: хвост длиннее и короче диапазона
+  for (size_t idx = 0; idx <= 5; ++idx) {
+    rpc::vector<int> rpc_v31{0, 1, 2, 3, 4};
+    rpc_v31.reserve(16);
+    rpc::vector<std::string> rpc_v31_str{"0", "1", "2", "3", "4"};
+    rpc_v31_str.reserve(16);
+    std::vector<std::string> words{"-1", "-2", "-3"};
+    auto it = rpc_v31.insert(rpc_v31.cbegin() + idx, source, source + 3);
+    rpc_v31_str.insert(rpc_v31_str.cbegin() + idx, words.begin(), words.end());
+    std::vector<int> expected{0, 1, 2, 3, 4};
+    expected.insert(expected.begin() + idx, source, source + 3);
+    EXPECT_EQ(*it, -1);
+    ASSERT_EQ(rpc_v31.size(), expected.size());
+    ASSERT_EQ(rpc_v31_str.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(rpc_v31[i], expected[i]);
+      EXPECT_EQ(rpc_v31_str[i], std::to_string(expected[i]));
+    }
+  }
+
+  // перевыделение: одна новая емкость под весь диапазон
+  rpc::vector<int> rpc_v31_grow{1, 2};
+  std::vector<int> many(100, 5);
+  rpc_v31_grow.insert(rpc_v31_grow.cbegin() + 1, many.begin(), many.end());
+  EXPECT_EQ(rpc_v31_grow.size(), 102U);
+  EXPECT_EQ(rpc_v31_grow.capacity(), 102U);
+  EXPECT_EQ(rpc_v31_grow[0], 1);
+  EXPECT_EQ(rpc_v31_grow[50], 5);
+  EXPECT_EQ(rpc_v31_grow[101], 2);
+
+  std::istringstream input("8 9");
+  rpc_v31_grow.insert(rpc_v31_grow.cbegin(), std::istream_iterator<int>(input),
+                      std::istream_iterator<int>());
+  EXPECT_EQ(rpc_v31_grow[0], 8);
+  EXPECT_EQ(rpc_v31_grow[1], 9);
+  EXPECT_EQ(rpc_v31_grow[2], 1);
+  EXPECT_THROW(rpc_v31_grow.insert(rpc_v31_grow.cbegin() + 200, source,
+                                   source + 3),
+               std::out_of_range);
+}
+
+TEST(vector_modifiers, case32_assign_append) {
+  Counted::alive = 0;
+  {
+    std::vector<Counted> source;
+    for (int i = 0; i < 10; ++i) source.emplace_back(i);
+    rpc::vector<Counted> rpc_v32;
+    rpc_v32.assign(source.begin(), source.begin() + 3);
+    EXPECT_EQ(rpc_v32.size(), 3U);
+    rpc_v32.append_range(source);
+    EXPECT_EQ(rpc_v32.size(), 13U);
+    EXPECT_EQ(rpc_v32[12].value, 9);
+    size_t capacity = rpc_v32.capacity();
+    rpc_v32.assign(source.begin() + 5, source.end());
+    EXPECT_EQ(rpc_v32.capacity(), capacity);
+    EXPECT_EQ(rpc_v32.size(), 5U);
+    EXPECT_EQ(rpc_v32[0].value, 5);
+    EXPECT_EQ(Counted::alive, 15);
+  }
+  EXPECT_EQ(Counted::alive, 0);
+
+  rpc::vector<int> rpc_v32_int{1};
+  rpc_v32_int.assign({4, 5, 6});
+  EXPECT_EQ(rpc_v32_int.size(), 3U);
+  EXPECT_EQ(rpc_v32_int[2], 6);
+}
+
+TEST(vector_modifiers, case33_erase_range) {
+  rpc::vector<int> rpc_v33{0, 1, 2, 3, 4, 5, 6, 7};
+  auto it = rpc_v33.erase(rpc_v33.cbegin() + 2, rpc_v33.cbegin() + 5);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(rpc_v33.size(), 5U);
+  EXPECT_EQ(rpc_v33[1], 1);
+  EXPECT_EQ(rpc_v33[2], 5);
+  it = rpc_v33.erase(rpc_v33.cbegin() + 3, rpc_v33.cbegin() + 5);
+  EXPECT_EQ(it, rpc_v33.end());
+  EXPECT_EQ(rpc_v33.erase(rpc_v33.cbegin(), rpc_v33.cbegin()), rpc_v33.begin());
+  EXPECT_EQ(rpc_v33.size(), 3U);
+  EXPECT_THROW(rpc_v33.erase(rpc_v33.cbegin() + 2, rpc_v33.cbegin() + 4),
+               std::out_of_range);
+  EXPECT_THROW(rpc_v33.erase(rpc_v33.cbegin() + 3), std::out_of_range);
+
+  Counted::alive = 0;
+  {
+    rpc::vector<Counted> rpc_v33_counted;
+    for (int i = 0; i < 10; ++i) rpc_v33_counted.emplace_back(i);
+    rpc_v33_counted.erase(rpc_v33_counted.cbegin(),
+                          rpc_v33_counted.cbegin() + 4);
+    EXPECT_EQ(Counted::alive, 6);
+    EXPECT_EQ(rpc_v33_counted[0].value, 4);
+    EXPECT_EQ(rpc_v33_counted[5].value, 9);
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(vector_modifiers, case34_copy_reuses_storage) {
+  rpc::vector<int> rpc_v34{1, 2, 3};
+  rpc::vector<int> rpc_v34_copy;
+  rpc_v34_copy.reserve(10);
+  int *data = rpc_v34_copy.data();
+  rpc_v34_copy = rpc_v34;
+  EXPECT_EQ(rpc_v34_copy.data(), data);
+  EXPECT_EQ(rpc_v34_copy.size(), 3U);
+  EXPECT_EQ(rpc_v34_copy[2], 3);
+
+  rpc::vector<int> rpc_v34_front;
+  for (int i = 0; i < 100; ++i) rpc_v34_front.insert(rpc_v34_front.begin(), i);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(rpc_v34_front[i], 99 - i);
+  rpc::vector<std::string> rpc_v34_str;
+  for (int i = 0; i < 20; ++i) {
+    rpc_v34_str.insert(rpc_v34_str.begin(), std::to_string(i));
+  }
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_EQ(rpc_v34_str[i], std::to_string(19 - i));
+  }
+}
+
+TEST(vector_capacity, case35_growth_policy) {
+  rpc::vector<int> rpc_v35_2x;
+  rpc::vector<int, std::allocator<int>, rpc::growth_1_5x> rpc_v35_1_5x;
+  rpc::vector<int, std::allocator<int>, rpc::geometric_growth<3, 2, 16>>
+      rpc_v35_min;
+  rpc::vector<int, std::allocator<int>, rpc::fixed_growth<100>> rpc_v35_fixed;
+  std::vector<size_t> capacities_2x, capacities_1_5x;
+  for (int i = 0; i < 1000; ++i) {
+    if (rpc_v35_2x.size() == rpc_v35_2x.capacity()) {
+      capacities_2x.push_back(rpc_v35_2x.capacity());
+    }
+    if (rpc_v35_1_5x.size() == rpc_v35_1_5x.capacity()) {
+      capacities_1_5x.push_back(rpc_v35_1_5x.capacity());
+    }
+    rpc_v35_2x.push_back(i);
+    rpc_v35_1_5x.push_back(i);
+    rpc_v35_min.push_back(i);
+    rpc_v35_fixed.push_back(i);
+  }
+  EXPECT_EQ(rpc_v35_2x.capacity(), 1024U);
+  EXPECT_EQ(capacities_1_5x, (std::vector<size_t>{
+                                 0,   1,   2,   3,   4,   6,   9,   13,  19,
+                                 28,  42,  63,  94,  141, 211, 316, 474, 711}));
+  EXPECT_EQ(capacities_2x.size(), 11U);
+  EXPECT_EQ(rpc_v35_fixed.capacity(), 1000U);
+  EXPECT_EQ(rpc_v35_fixed[999], 999);
+
+  EXPECT_EQ(rpc_v35_2x.stats().reallocs, 11U);
+  EXPECT_EQ(rpc_v35_2x.stats().bytes_copied, 1023 * sizeof(int));
+  EXPECT_EQ(rpc_v35_1_5x.stats().reallocs, capacities_1_5x.size());
+  EXPECT_EQ(rpc_v35_fixed.stats().reallocs, 10U);
+  EXPECT_EQ(rpc_v35_fixed.stats().bytes_copied, 4500 * sizeof(int));
+
+  rpc::vector<int, std::allocator<int>, rpc::geometric_growth<3, 2, 16>>
+      rpc_v35_first;
+  rpc_v35_first.push_back(1);
+  EXPECT_EQ(rpc_v35_first.capacity(), 16U);
+  EXPECT_EQ(rpc_v35_min.stats().reallocs, 12U);
+
+  rpc::vector<int> rpc_v35_moved(std::move(rpc_v35_2x));
+  EXPECT_EQ(rpc_v35_moved.stats().reallocs, 11U);
+  EXPECT_EQ(rpc_v35_2x.stats().reallocs, 0U);
+}
+
+TEST(vector_modifiers, case36_erase_empty) {
+  rpc::vector<int> rpc_v36_int;
+  EXPECT_EQ(rpc_v36_int.erase(rpc_v36_int.cbegin(), rpc_v36_int.cbegin()),
+            rpc_v36_int.end());
+  EXPECT_TRUE(rpc_v36_int.empty());
+  EXPECT_THROW(rpc_v36_int.erase(rpc_v36_int.cbegin()), std::out_of_range);
+
+  rpc::vector<std::string> rpc_v36_str;
+  EXPECT_EQ(rpc_v36_str.erase(rpc_v36_str.cbegin(), rpc_v36_str.cbegin()),
+            rpc_v36_str.end());
+  EXPECT_TRUE(rpc_v36_str.empty());
+
+  rpc_v36_int.push_back(1);
+  rpc_v36_int.clear();
+  EXPECT_EQ(rpc_v36_int.erase(rpc_v36_int.cbegin(), rpc_v36_int.cbegin()),
+            rpc_v36_int.end());
+  EXPECT_TRUE(rpc_v36_int.empty());
+}
+
+TEST(vector_capacity, case37_copy_assign_capacity) {
+  rpc::vector<std::string> rpc_v37_src;
+  rpc_v37_src.reserve(1000);
+  rpc_v37_src.push_back("a");
+  rpc_v37_src.push_back("b");
+  rpc::vector<std::string> rpc_v37_dst;
+  rpc_v37_dst = rpc_v37_src;
+  EXPECT_EQ(rpc_v37_dst.size(), 2U);
+  EXPECT_EQ(rpc_v37_dst.capacity(), 2U);
+  EXPECT_EQ(rpc_v37_dst[1], "b");
+
+  rpc::vector<int> rpc_v37_int(1000);
+  rpc_v37_int.clear();
+  rpc::vector<int> rpc_v37_int_dst{1, 2, 3};
+  rpc_v37_int_dst = rpc_v37_int;
+  EXPECT_TRUE(rpc_v37_int_dst.empty());
+  EXPECT_EQ(rpc_v37_int_dst.capacity(), 3U);
+  rpc_v37_int.push_back(7);
+  rpc::vector<int> rpc_v37_int_small;
+  rpc_v37_int_small = rpc_v37_int;
+  EXPECT_EQ(rpc_v37_int_small.capacity(), 1U);
+  EXPECT_EQ(rpc_v37_int_small[0], 7);
+}
+
 TEST(vector_exceptions, case99_exceptions) {
   rpc::vector<int> V1{3, 8, 15};
   rpc::vector<char> V2;
   EXPECT_THROW(V1.at(6), std::out_of_range);
-  EXPECT_THROW(V1[-6], std::out_of_range);
+  EXPECT_THROW(V1.at(-6), std::out_of_range);
   EXPECT_THROW(V2.front(), std::out_of_range);
   EXPECT_THROW(V2.back(), std::out_of_range);
   EXPECT_THROW(V1.reserve(V1.max_size() + 1), std::out_of_range);